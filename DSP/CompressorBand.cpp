@@ -9,46 +9,43 @@
 */
 
 #include "CompressorBand.h"
+#include "../Service/Parameters.h"
 
-void CompressorBand::prepare(const juce::dsp::ProcessSpec& spec)
+template<typename SampleType>
+void CompressorBand<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
 {
     compressor.prepare(spec);
 }
 
-void CompressorBand::updateCompressorSettings()
+template<typename SampleType>
+void CompressorBand<SampleType>::updateCompressorSettings()
 {
     compressor.setAttack(attack->get());
     compressor.setRelease(release->get());
     compressor.setThreshold(threshold->get());
-    compressor.setRatio(ratio->getCurrentChoiceName().getFloatValue());
+    const float ratioValue = Parameters::RatioValues[static_cast<size_t>(ratio->getIndex())];
+    compressor.setRatio(ratioValue);
+    compressor.setMix(mix->get() / 100.0f);
+    compressor.setBypassed(bypassed->get());
+
+    // auto makeup restores half of the reduction a 0 dB signal would see
+    float makeupDb = makeupGain->get();
+    if (autoMakeup->get())
+        makeupDb += -threshold->get() * (1.0f - 1.0f / ratioValue) * 0.5f;
+
+    makeupGainLinear = bypassed->get()
+        ? SampleType(1)
+        : juce::Decibels::decibelsToGain(static_cast<SampleType>(makeupDb));
 }
 
-void CompressorBand::process(juce::AudioBuffer<float>& buffer)
+template<typename SampleType>
+void CompressorBand<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
 {
-    float inputRMS = computeRMSLevel(buffer);
-    auto block = juce::dsp::AudioBlock<float>(buffer);
-    auto context = juce::dsp::ProcessContextReplacing<float>(block);
+    MBCOMP_TRACE_SCOPE("CompressorBand::process");
 
-    context.isBypassed = bypassed->get();
-    compressor.process(context);
-
-    float outputRMS = computeRMSLevel(buffer);
-
-    rmsInputLevelDb.store(juce::Decibels::gainToDecibels(inputRMS));
-    rmsOutputLevelDb.store(juce::Decibels::gainToDecibels(outputRMS));
+    // runs while bypassed too, so the envelope and meters keep up
+    compressor.process(buffer);
 }
 
-float CompressorBand::computeRMSLevel(const juce::AudioBuffer<float>& buffer)
-{
-    int numChannels = static_cast<int>(buffer.getNumChannels());
-    int numSamples = static_cast<int>(buffer.getNumSamples());
-    float rms = 0.0f;
-
-    for (int chan = 0; chan < numChannels; ++chan)
-    {
-        rms += buffer.getRMSLevel(chan, 0, numSamples);
-    }
-
-    rms /= static_cast<float>(numChannels);
-    return rms;
-}
+template struct CompressorBand<float>;
+template struct CompressorBand<double>;
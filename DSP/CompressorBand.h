@@ -11,8 +11,11 @@
 #pragma once
 #include <JuceHeader.h>
 #include "Constants.h";
+#include "CompressorKernel.h"
+#include "TraceRecorder.h"
 
 
+template<typename SampleType>
 struct CompressorBand
 {
     CompressorBand() = default;
@@ -24,21 +27,30 @@ struct CompressorBand
     juce::AudioParameterBool* bypassed{ nullptr };
     juce::AudioParameterBool* mute{ nullptr };
     juce::AudioParameterBool* solo{ nullptr };
+    juce::AudioParameterChoice* stereoMode{ nullptr };
+    juce::AudioParameterFloat* makeupGain{ nullptr };
+    juce::AudioParameterBool* autoMakeup{ nullptr };
+    juce::AudioParameterFloat* mix{ nullptr };
 
     void prepare(const juce::dsp::ProcessSpec& spec);
     void updateCompressorSettings();
-    void process(juce::AudioBuffer<float>& buffer);
+    void setLinkGroups(const int* groupForChannel) { compressor.setLinkGroups(groupForChannel); }
+    void setChannelMask(juce::uint32 mask) { compressor.setChannelMask(mask); }
+    void process(juce::AudioBuffer<SampleType>& buffer);
 
-    float getRmsInputLevelDb() const { return rmsInputLevelDb; }
-    float getRmsOutputLevelDb() const { return rmsOutputLevelDb; }
+    /** For a band nobody can hear: keeps the envelope following the band and the meter
+        periods in step without compressing. */
+    void skip(const juce::AudioBuffer<SampleType>& buffer) { compressor.skip(buffer); }
 
-private:
-    juce::dsp::Compressor<float> compressor;
+    /** Linear makeup gain for the band summation, unity while the band is bypassed. */
+    SampleType getMakeupGain() const { return makeupGainLinear; }
 
-    std::atomic<float> rmsInputLevelDb{ NEGATIVE_INFINITY };
-    std::atomic<float> rmsOutputLevelDb{ NEGATIVE_INFINITY };
+    int getNumCompletedMeters() const { return compressor.getNumCompletedMeters(); }
+    const BandMeter& getCompletedMeter(int index) const { return compressor.getCompletedMeter(index); }
 
-    float computeRMSLevel(const juce::AudioBuffer<float>& buffer);
+private:
+    CompressorKernel<SampleType> compressor;
+    SampleType makeupGainLinear{ 1 };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CompressorBand)
 };
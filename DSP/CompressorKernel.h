@@ -0,0 +1,406 @@
+/*
+  ==============================================================================
+
+    CompressorKernel.h
+    Created: 19 Oct 2026 1:40:22pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <vector>
+#include "Constants.h"
+#include "Metering.h"
+
+/*
+    Feed-forward peak compressor with the same ballistics and gain computer as
+    juce::dsp::Compressor, but with its envelope state stored structure-of-arrays
+    (one lane per channel, padded to KERNEL_LANE_WIDTH) so detection and gain
+    computation run across channels in the inner loop.
+
+    Channels can be linked in groups: every channel of a linked group is driven
+    by the loudest envelope of that group, so the group is gain-reduced together.
+
+    Output peak, RMS and gain reduction are gathered in the gain loop and closed
+    off every meter period; chunks are cut at period boundaries so no sample is
+    split between two meters.
+*/
+template<typename SampleType>
+struct CompressorKernel
+{
+    CompressorKernel() = default;
+
+    /** Retunes for the new sample rate; the envelope is kept unless the channel count changed. */
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    /** Crossfades to unity gain over BAND_FADE_MS. The envelope keeps running while
+        bypassed, so coming back is seamless; once fully bypassed the gain computer is skipped. */
+    void setBypassed(bool shouldBeBypassed);
+
+    void setAttack(SampleType attackMs);
+    void setRelease(SampleType releaseMs);
+    void setThreshold(SampleType thresholdDb);
+    void setRatio(SampleType ratio);
+
+    /** Parallel compression, folded into the gain: 0 leaves the signal dry, 1 is fully compressed. */
+    void setMix(SampleType mix);
+
+    /** One entry per channel: the link group it belongs to, or -1 for its own detector. */
+    void setLinkGroups(const int* groupForChannel);
+
+    /** Bit per channel: cleared channels keep their envelope running but pass through unchanged. */
+    void setChannelMask(juce::uint32 mask);
+
+    void process(juce::AudioBuffer<SampleType>& buffer);
+
+    /** Stands in for process() while the band is silent: the envelope keeps following
+        the band, so it is already settled when the band comes back, and the meter
+        periods advance over silence. The audio is not touched. */
+    void skip(const juce::AudioBuffer<SampleType>& buffer);
+
+    /** Meter periods completed by the last process() call, oldest first. */
+    int getNumCompletedMeters() const { return numCompletedMeters; }
+    const BandMeter& getCompletedMeter(int index) const { return completedMeters[static_cast<size_t>(index)]; }
+
+private:
+    static constexpr int chunkSize = 64;
+
+    SampleType calculateCte(SampleType timeMs) const;
+    void followEnvelope(const juce::AudioBuffer<SampleType>& buffer, int start, int count);
+    void updateLaneGains();
+    void completeMeter();
+
+    double expFactor{ 0.0 };
+    SampleType cteAttack{ 0 }, cteRelease{ 0 };
+    SampleType threshold{ 1 }, thresholdInverse{ 1 }, ratioInverse{ 1 };
+    SampleType wetGain{ 1 };
+    bool bypassed{ false };
+
+    // 1 while compressing, 0 once fully bypassed, moved by fadeStep per sample in between
+    SampleType activeAmount{ 1 };
+    SampleType fadeStep{ 1 };
+
+    int numChannels{ 0 };
+    int paddedChannels{ 0 };
+    bool anyLinked{ false };
+    juce::uint32 channelMask{ 0xffffffff };
+
+    // per lane share of the compressed gain, mix and channel mask in one place
+    std::vector<SampleType> laneWet;
+
+    std::vector<SampleType> envelope;
+    std::vector<SampleType> detector, gains;
+    std::vector<int> linkGroup;
+    std::vector<SampleType> groupPeak;
+
+    int samplesPerMeter{ 1 };
+    int meterPosition{ 0 };
+    std::vector<SampleType> meterPeak, meterSumSquares, meterMinGain;
+    std::vector<BandMeter> completedMeters;
+    int numCompletedMeters{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CompressorKernel)
+};
+
+//==============================================================================
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    expFactor = -2.0 * juce::MathConstants<double>::pi * 1000.0 / spec.sampleRate;
+
+    fadeStep = static_cast<SampleType>(1000.0 / (BAND_FADE_MS * spec.sampleRate));
+
+    // a block can close at most one meter per samplesPerMeter samples, plus one straddling the start
+    const int previousSamplesPerMeter = samplesPerMeter;
+    samplesPerMeter = juce::jmax(1, juce::roundToInt(spec.sampleRate / METER_RATE_HZ));
+    completedMeters.resize(static_cast<size_t>(spec.maximumBlockSize / samplesPerMeter + 2));
+    numCompletedMeters = 0;
+
+    // Attack and release are recomputed from the new expFactor by the next setAttack/setRelease.
+    // The envelope and bypass fade carry on, a meter period only restarts if its length changed.
+    if (static_cast<int>(spec.numChannels) == numChannels && !envelope.empty())
+    {
+        if (samplesPerMeter != previousSamplesPerMeter)
+        {
+            std::fill(meterPeak.begin(), meterPeak.end(), SampleType(0));
+            std::fill(meterSumSquares.begin(), meterSumSquares.end(), SampleType(0));
+            std::fill(meterMinGain.begin(), meterMinGain.end(), SampleType(1));
+            meterPosition = 0;
+        }
+
+        return;
+    }
+
+    activeAmount = bypassed ? SampleType(0) : SampleType(1);
+
+    numChannels = static_cast<int>(spec.numChannels);
+    paddedChannels = getPaddedChannelCount(numChannels);
+
+    envelope.assign(static_cast<size_t>(paddedChannels), SampleType(0));
+    detector.assign(static_cast<size_t>(chunkSize * paddedChannels), SampleType(0));
+    gains.assign(static_cast<size_t>(chunkSize * paddedChannels), SampleType(1));
+    linkGroup.assign(static_cast<size_t>(paddedChannels), -1);
+    groupPeak.assign(static_cast<size_t>(paddedChannels), SampleType(0));
+    anyLinked = false;
+
+    laneWet.assign(static_cast<size_t>(paddedChannels), SampleType(1));
+    updateLaneGains();
+
+    meterPosition = 0;
+    meterPeak.assign(static_cast<size_t>(paddedChannels), SampleType(0));
+    meterSumSquares.assign(static_cast<size_t>(paddedChannels), SampleType(0));
+    meterMinGain.assign(static_cast<size_t>(paddedChannels), SampleType(1));
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::reset()
+{
+    std::fill(envelope.begin(), envelope.end(), SampleType(0));
+}
+
+template<typename SampleType>
+inline SampleType CompressorKernel<SampleType>::calculateCte(SampleType timeMs) const
+{
+    // matches juce::dsp::BallisticsFilter
+    return timeMs < static_cast<SampleType>(1.0e-3) ? SampleType(0)
+        : static_cast<SampleType>(std::exp(expFactor / static_cast<double>(timeMs)));
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::setAttack(SampleType attackMs)
+{
+    cteAttack = calculateCte(attackMs);
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::setRelease(SampleType releaseMs)
+{
+    cteRelease = calculateCte(releaseMs);
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::setThreshold(SampleType thresholdDb)
+{
+    threshold = juce::Decibels::decibelsToGain(thresholdDb, static_cast<SampleType>(-200.0));
+    thresholdInverse = SampleType(1) / threshold;
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::setRatio(SampleType ratio)
+{
+    jassert(ratio >= SampleType(1));
+    ratioInverse = SampleType(1) / ratio;
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::setMix(SampleType mix)
+{
+    wetGain = juce::jlimit(SampleType(0), SampleType(1), mix);
+    updateLaneGains();
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::setBypassed(bool shouldBeBypassed)
+{
+    bypassed = shouldBeBypassed;
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::setChannelMask(juce::uint32 mask)
+{
+    channelMask = mask;
+    updateLaneGains();
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::updateLaneGains()
+{
+    for (size_t lane = 0; lane < laneWet.size(); ++lane)
+    {
+        const bool active = lane < 32 && (channelMask & (1u << lane)) != 0;
+        laneWet[lane] = active ? wetGain : SampleType(0);
+    }
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::completeMeter()
+{
+    if (numCompletedMeters < static_cast<int>(completedMeters.size()))
+    {
+        auto& meter = completedMeters[static_cast<size_t>(numCompletedMeters++)];
+        meter.numChannels = juce::jmin(numChannels, MAX_CHANNELS);
+
+        const auto meterLength = static_cast<SampleType>(samplesPerMeter);
+        for (int ch = 0; ch < meter.numChannels; ++ch)
+        {
+            const auto index = static_cast<size_t>(ch);
+            meter.peakDb[index] = static_cast<float>(juce::Decibels::gainToDecibels(meterPeak[index], SampleType(NEGATIVE_INFINITY)));
+            meter.rmsDb[index] = static_cast<float>(juce::Decibels::gainToDecibels(std::sqrt(meterSumSquares[index] / meterLength), SampleType(NEGATIVE_INFINITY)));
+            meter.gainReductionDb[index] = -static_cast<float>(juce::Decibels::gainToDecibels(meterMinGain[index], SampleType(NEGATIVE_INFINITY)));
+        }
+    }
+
+    std::fill(meterPeak.begin(), meterPeak.end(), SampleType(0));
+    std::fill(meterSumSquares.begin(), meterSumSquares.end(), SampleType(0));
+    std::fill(meterMinGain.begin(), meterMinGain.end(), SampleType(1));
+    meterPosition = 0;
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::setLinkGroups(const int* groupForChannel)
+{
+    anyLinked = false;
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        jassert(groupForChannel[ch] < paddedChannels);
+        linkGroup[static_cast<size_t>(ch)] = groupForChannel[ch];
+        anyLinked = anyLinked || groupForChannel[ch] >= 0;
+    }
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::followEnvelope(const juce::AudioBuffer<SampleType>& buffer, int start, int count)
+{
+    const int chans = juce::jmin(buffer.getNumChannels(), numChannels);
+    const int lanes = paddedChannels;
+    SampleType* env = envelope.data();
+
+    for (int ch = 0; ch < chans; ++ch)
+    {
+        const SampleType* in = buffer.getReadPointer(ch, start);
+        for (int i = 0; i < count; ++i)
+            detector[static_cast<size_t>(i * lanes + ch)] = std::abs(in[i]);
+    }
+
+    // detector becomes the envelope, sample by sample
+    for (int i = 0; i < count; ++i)
+    {
+        SampleType* level = detector.data() + i * lanes;
+
+        for (int lane = 0; lane < lanes; ++lane)
+        {
+            const SampleType x = level[lane];
+            const SampleType cte = x > env[lane] ? cteAttack : cteRelease;
+            env[lane] = x + cte * (env[lane] - x);
+            level[lane] = env[lane];
+        }
+    }
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::skip(const juce::AudioBuffer<SampleType>& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
+    numCompletedMeters = 0;
+
+    for (int start = 0; start < numSamples;)
+    {
+        const int count = juce::jmin(chunkSize, numSamples - start, samplesPerMeter - meterPosition);
+
+        followEnvelope(buffer, start, count);
+
+        start += count;
+        meterPosition += count;
+
+        if (meterPosition == samplesPerMeter)
+            completeMeter();
+    }
+}
+
+template<typename SampleType>
+inline void CompressorKernel<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
+    const int chans = juce::jmin(buffer.getNumChannels(), numChannels);
+    const int lanes = paddedChannels;
+    const SampleType exponent = ratioInverse - SampleType(1);
+
+    numCompletedMeters = 0;
+
+    const SampleType fadeIncrement = bypassed ? -fadeStep : fadeStep;
+
+    for (int start = 0; start < numSamples;)
+    {
+        const int count = juce::jmin(chunkSize, numSamples - start, samplesPerMeter - meterPosition);
+
+        // fully bypassed: only the envelope runs, the audio passes untouched
+        const bool fullyBypassed = bypassed && activeAmount == SampleType(0);
+
+        followEnvelope(buffer, start, count);
+
+        if (!fullyBypassed)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                SampleType* level = detector.data() + i * lanes;
+                SampleType* gain = gains.data() + i * lanes;
+
+                activeAmount = juce::jlimit(SampleType(0), SampleType(1), activeAmount + fadeIncrement);
+
+                if (anyLinked)
+                {
+                    std::fill(groupPeak.begin(), groupPeak.end(), SampleType(0));
+
+                    for (int ch = 0; ch < chans; ++ch)
+                        if (const int group = linkGroup[static_cast<size_t>(ch)]; group >= 0)
+                            groupPeak[static_cast<size_t>(group)] = juce::jmax(groupPeak[static_cast<size_t>(group)], level[ch]);
+
+                    for (int ch = 0; ch < chans; ++ch)
+                        if (const int group = linkGroup[static_cast<size_t>(ch)]; group >= 0)
+                            level[ch] = groupPeak[static_cast<size_t>(group)];
+                }
+
+                for (int lane = 0; lane < lanes; ++lane)
+                {
+                    const SampleType g = level[lane] < threshold
+                        ? SampleType(1)
+                        : std::pow(level[lane] * thresholdInverse, exponent);
+
+                    gain[lane] = SampleType(1) + activeAmount * laneWet[lane] * (g - SampleType(1));
+                }
+            }
+        }
+
+        for (int ch = 0; ch < chans; ++ch)
+        {
+            SampleType* out = buffer.getWritePointer(ch, start);
+            const auto c = static_cast<size_t>(ch);
+            SampleType peak = meterPeak[c], sumSquares = meterSumSquares[c], minGain = meterMinGain[c];
+
+            if (fullyBypassed)
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    peak = juce::jmax(peak, std::abs(out[i]));
+                    sumSquares += out[i] * out[i];
+                }
+            }
+            else
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    const SampleType g = gains[static_cast<size_t>(i * lanes + ch)];
+                    const SampleType y = out[i] * g;
+                    out[i] = y;
+
+                    peak = juce::jmax(peak, std::abs(y));
+                    sumSquares += y * y;
+                    minGain = juce::jmin(minGain, g);
+                }
+            }
+
+            meterPeak[c] = peak;
+            meterSumSquares[c] = sumSquares;
+            meterMinGain[c] = minGain;
+        }
+
+        start += count;
+        meterPosition += count;
+
+        if (meterPosition == samplesPerMeter)
+            completeMeter();
+    }
+}
@@ -18,6 +18,53 @@
 
 #define MIN_THRESHOLD -60.0f
 
+#define MIN_PARTITION_SIZE 128
+#define MAX_PARTITION_SIZE 1024
+#define NUM_PARTITION_SIZES 4
+
+#define MAX_CHANNELS 16
+#define KERNEL_LANE_WIDTH 4
+
+// the engine runs host blocks of any size as fixed periods of this many samples
+#define ENGINE_SUB_BLOCK_SIZE 64
+
+// band mute, solo and bypass changes crossfade over this long
+#define BAND_FADE_MS 5.0
+
+// switching between the Linkwitz-Riley and linear phase crossovers crossfades over this long
+#define CROSSOVER_FADE_MS 20.0
+
+#define METER_RATE_HZ 100
+#define METER_FIFO_CAPACITY 64
+
+// analysis for every open editor in the process shares this many workers and this much worker time per frame
+#define ANALYZER_MAX_WORKERS 2
+#define ANALYZER_FRAME_BUDGET_MS 4.0
+
+#define GR_HISTORY_SECONDS 8
+#define GR_SCOPE_RANGE_DB 24.0f
+
+// developer builds only: instrumentation (performance HUD and trace markers), still off at runtime until enabled
+#ifndef MBCOMP_PROFILING
+#define MBCOMP_PROFILING 0
+#endif
+
+// developer builds only: the micro benchmark suite and the button that runs it
+#ifndef MBCOMP_BENCHMARKS
+#define MBCOMP_BENCHMARKS 0
+#endif
+
+// developer builds only: golden output renders of the whole processor
+#ifndef MBCOMP_REGRESSION_HARNESS
+#define MBCOMP_REGRESSION_HARNESS 0
+#endif
+
+// developer builds only: replaces global operator new/delete, and on glibc interposes
+// malloc/calloc/realloc/free and pthread_mutex_lock, to catch audio thread allocations and locks
+#ifndef MBCOMP_REALTIME_CHECKS
+#define MBCOMP_REALTIME_CHECKS 0
+#endif
+
 enum Channel
 {
     Right, //effectively 0
@@ -32,4 +79,43 @@ enum FFTOrder
     order8192 = 13
 };
 
+enum CrossoverMode
+{
+    LinkwitzRiley,
+    LinearPhase
+};
+
+// what the built-in generator feeds the processor instead of its input
+enum TestSignal
+{
+    TestSignalOff,
+    SineSignal,
+    PinkNoiseSignal,
+    LogSweepSignal,
+    ImpulseSignal
+};
+
+// per band channel routing, the mid/side modes only apply to stereo buses
+enum StereoMode
+{
+    LeftRight,
+    MidSide,
+    MidOnly,
+    SideOnly
+};
+
+enum ChannelGroup
+{
+    FrontGroup,
+    SurroundGroup,
+    OtherGroup, // LFE, height and discrete channels
+    NumChannelGroups
+};
+
+// channel count rounded up so SoA kernels always work on whole SIMD registers
+inline int getPaddedChannelCount(int numChannels)
+{
+    return (numChannels + KERNEL_LANE_WIDTH - 1) / KERNEL_LANE_WIDTH * KERNEL_LANE_WIDTH;
+}
+
 
@@ -0,0 +1,222 @@
+/*
+  ==============================================================================
+
+    CrossoverKernel.h
+    Created: 19 Oct 2026 1:40:22pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+#include "Constants.h"
+
+/*
+    Three band Linkwitz-Riley (LR4) splitter, same topology and TPT state
+    variable sections as juce::dsp::LinkwitzRileyFilter:
+
+        low  = AP(midHigh, LP(lowMid, x))
+        mid  = LP(midHigh, HP(lowMid, x))
+        high = HP(midHigh, HP(lowMid, x))
+
+    Filter state is stored structure-of-arrays (one contiguous array per state
+    variable, one lane per channel, padded to KERNEL_LANE_WIDTH) and the input
+    is interleaved in short chunks, so the per-sample loop runs across channels
+    and maps onto SIMD lanes. All three bands come out of a single pass.
+*/
+template<typename SampleType>
+struct CrossoverKernel
+{
+    CrossoverKernel() = default;
+
+    /** Retunes for the new sample rate; filter state is kept unless the channel count changed. */
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    void setCrossoverFrequencies(float lowMidFreq, float midHighFreq);
+
+    void process(const juce::AudioBuffer<SampleType>& input, std::array<juce::AudioBuffer<SampleType>, 3>& bands);
+
+private:
+    static constexpr int chunkSize = 64;
+
+    struct Coefficients
+    {
+        SampleType g{ 0 }, h{ 0 }, r2PlusG{ 0 };
+    };
+
+    // one state array per section variable, see process()
+    enum StateIndex
+    {
+        split1S1, split1S2, split1LowS1, split1LowS2, split1HighS1, split1HighS2,
+        allpassS1, allpassS2,
+        split2S1, split2S2, split2LowS1, split2LowS2, split2HighS1, split2HighS2,
+        numStates
+    };
+
+    static Coefficients makeCoefficients(double cutoff, double sampleRate);
+    SampleType* getState(StateIndex index) { return state.data() + index * paddedChannels; }
+
+    double sampleRate{ 44100.0 };
+    int numChannels{ 0 };
+    int paddedChannels{ 0 };
+
+    float currentLowMid{ 0.0f }, currentMidHigh{ 0.0f };
+    Coefficients lowMid, midHigh;
+
+    std::vector<SampleType> state;
+    std::vector<SampleType> interleavedInput, interleavedLow, interleavedMid, interleavedHigh;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CrossoverKernel)
+};
+
+//==============================================================================
+namespace CrossoverKernelDetail
+{
+    static constexpr double sqrt2 = 1.41421356237309504880;
+
+    // one TPT state variable section (Butterworth Q), as in juce::dsp::LinkwitzRileyFilter
+    template<typename SampleType, typename Coeffs>
+    inline void svf(SampleType x, SampleType& s1, SampleType& s2, const Coeffs& c,
+        SampleType& yL, SampleType& yB, SampleType& yH)
+    {
+        yH = (x - c.r2PlusG * s1 - s2) * c.h;
+        yB = c.g * yH + s1;
+        s1 = c.g * yH + yB;
+        yL = c.g * yB + s2;
+        s2 = c.g * yB + yL;
+    }
+}
+
+template<typename SampleType>
+inline typename CrossoverKernel<SampleType>::Coefficients
+CrossoverKernel<SampleType>::makeCoefficients(double cutoff, double rate)
+{
+    const double g = std::tan(juce::MathConstants<double>::pi * cutoff / rate);
+
+    Coefficients c;
+    c.g = static_cast<SampleType>(g);
+    c.h = static_cast<SampleType>(1.0 / (1.0 + CrossoverKernelDetail::sqrt2 * g + g * g));
+    c.r2PlusG = static_cast<SampleType>(CrossoverKernelDetail::sqrt2 + g);
+    return c;
+}
+
+template<typename SampleType>
+inline void CrossoverKernel<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    sampleRate = spec.sampleRate;
+
+    // force the coefficients to be rebuilt for the new sample rate
+    currentLowMid = currentMidHigh = 0.0f;
+
+    // TPT state stays valid across a coefficient change, it is only cleared when the channels change
+    if (static_cast<int>(spec.numChannels) == numChannels && !state.empty())
+        return;
+
+    numChannels = static_cast<int>(spec.numChannels);
+    paddedChannels = getPaddedChannelCount(numChannels);
+
+    state.assign(static_cast<size_t>(numStates * paddedChannels), SampleType(0));
+
+    const auto interleavedSize = static_cast<size_t>(chunkSize * paddedChannels);
+    interleavedInput.assign(interleavedSize, SampleType(0));
+    interleavedLow.assign(interleavedSize, SampleType(0));
+    interleavedMid.assign(interleavedSize, SampleType(0));
+    interleavedHigh.assign(interleavedSize, SampleType(0));
+}
+
+template<typename SampleType>
+inline void CrossoverKernel<SampleType>::reset()
+{
+    std::fill(state.begin(), state.end(), SampleType(0));
+}
+
+template<typename SampleType>
+inline void CrossoverKernel<SampleType>::setCrossoverFrequencies(float lowMidFreq, float midHighFreq)
+{
+    if (lowMidFreq != currentLowMid)
+    {
+        lowMid = makeCoefficients(lowMidFreq, sampleRate);
+        currentLowMid = lowMidFreq;
+    }
+
+    if (midHighFreq != currentMidHigh)
+    {
+        midHigh = makeCoefficients(midHighFreq, sampleRate);
+        currentMidHigh = midHighFreq;
+    }
+}
+
+template<typename SampleType>
+inline void CrossoverKernel<SampleType>::process(const juce::AudioBuffer<SampleType>& input,
+    std::array<juce::AudioBuffer<SampleType>, 3>& bands)
+{
+    using CrossoverKernelDetail::svf;
+
+    const int numSamples = input.getNumSamples();
+    const int chans = juce::jmin(input.getNumChannels(), numChannels);
+    const int lanes = paddedChannels;
+    const auto r2 = static_cast<SampleType>(CrossoverKernelDetail::sqrt2);
+
+    SampleType* s[numStates];
+    for (int i = 0; i < numStates; ++i)
+        s[i] = getState(static_cast<StateIndex>(i));
+
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        const int count = juce::jmin(chunkSize, numSamples - start);
+
+        for (int ch = 0; ch < chans; ++ch)
+        {
+            const SampleType* in = input.getReadPointer(ch, start);
+            for (int i = 0; i < count; ++i)
+                interleavedInput[static_cast<size_t>(i * lanes + ch)] = in[i];
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            const SampleType* x = interleavedInput.data() + i * lanes;
+            SampleType* low = interleavedLow.data() + i * lanes;
+            SampleType* mid = interleavedMid.data() + i * lanes;
+            SampleType* high = interleavedHigh.data() + i * lanes;
+
+            for (int lane = 0; lane < lanes; ++lane)
+            {
+                SampleType yL, yB, yH, unused1, unused2;
+
+                // lowMid split: the first section is shared by both outputs
+                svf(x[lane], s[split1S1][lane], s[split1S2][lane], lowMid, yL, yB, yH);
+
+                SampleType lowBand, rest;
+                svf(yL, s[split1LowS1][lane], s[split1LowS2][lane], lowMid, lowBand, unused1, unused2);
+                svf(yH, s[split1HighS1][lane], s[split1HighS2][lane], lowMid, unused1, unused2, rest);
+
+                // keeps the low band in phase with mid + high
+                svf(lowBand, s[allpassS1][lane], s[allpassS2][lane], midHigh, yL, yB, yH);
+                low[lane] = yL - r2 * yB + yH;
+
+                svf(rest, s[split2S1][lane], s[split2S2][lane], midHigh, yL, yB, yH);
+                svf(yL, s[split2LowS1][lane], s[split2LowS2][lane], midHigh, mid[lane], unused1, unused2);
+                svf(yH, s[split2HighS1][lane], s[split2HighS2][lane], midHigh, unused1, unused2, high[lane]);
+            }
+        }
+
+        for (int ch = 0; ch < chans; ++ch)
+        {
+            SampleType* low = bands[0].getWritePointer(ch, start);
+            SampleType* mid = bands[1].getWritePointer(ch, start);
+            SampleType* high = bands[2].getWritePointer(ch, start);
+
+            for (int i = 0; i < count; ++i)
+            {
+                const auto index = static_cast<size_t>(i * lanes + ch);
+                low[i] = interleavedLow[index];
+                mid[i] = interleavedMid[index];
+                high[i] = interleavedHigh[index];
+            }
+        }
+    }
+}
@@ -10,6 +10,7 @@
 
 #pragma once
 #include <array>
+#include <atomic>
 #include <vector>
 #include <JuceHeader.h>
 #include <juce_audio_basics/juce_audio_basics.h>
@@ -17,7 +18,7 @@
 #include "Constants.h"
 
 
-template<typename T>
+template<typename T, int Capacity = 30>
 struct Fifo
 {
     Fifo() : fifo(Capacity) {}
@@ -29,18 +30,21 @@ struct Fifo
 
     int getNumAvailableForReading() const;
 
+    /** Pushes rejected because the reader had fallen behind. */
+    int getNumDropped() const { return numDropped.load(std::memory_order_relaxed); }
+
 private:
-    static constexpr int Capacity = 30;
     std::array<T, Capacity> buffers;
     juce::AbstractFifo fifo{ Capacity };
+    std::atomic<int> numDropped{ 0 };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Fifo)
 };
 
 //----------------------------------------------//
 
-template<typename T>
-inline void Fifo<T>::prepare(int numChannels, int numSamples)
+template<typename T, int Capacity>
+inline void Fifo<T, Capacity>::prepare(int numChannels, int numSamples)
 {
     static_assert(std::is_same_v<T, juce::AudioBuffer<float>>,
         "prepare(numChannels, numSamples) valid only for juce::AudioBuffer<float>");
@@ -55,8 +59,8 @@ inline void Fifo<T>::prepare(int numChannels, int numSamples)
     }
 }
 
-template<typename T>
-inline void Fifo<T>::prepare(size_t numElements)
+template<typename T, int Capacity>
+inline void Fifo<T, Capacity>::prepare(size_t numElements)
 {
     static_assert(std::is_same_v<T, std::vector<float>>,
         "prepare(numElements) valid only for std::vector<float>");
@@ -67,8 +71,8 @@ inline void Fifo<T>::prepare(size_t numElements)
     }
 }
 
-template<typename T>
-inline bool Fifo<T>::push(const T& t)
+template<typename T, int Capacity>
+inline bool Fifo<T, Capacity>::push(const T& t)
 {
     auto write = fifo.write(1);
     if (write.blockSize1 > 0)
@@ -76,11 +80,12 @@ inline bool Fifo<T>::push(const T& t)
         buffers[write.startIndex1] = t;
         return true;
     }
+    numDropped.fetch_add(1, std::memory_order_relaxed);
     return false;
 }
 
-template<typename T>
-inline bool Fifo<T>::pull(T& t)
+template<typename T, int Capacity>
+inline bool Fifo<T, Capacity>::pull(T& t)
 {
     auto read = fifo.read(1);
     if (read.blockSize1 > 0)
@@ -91,8 +96,8 @@ inline bool Fifo<T>::pull(T& t)
     return false;
 }
 
-template<typename T>
-inline int Fifo<T>::getNumAvailableForReading() const
+template<typename T, int Capacity>
+inline int Fifo<T, Capacity>::getNumAvailableForReading() const
 {
     return fifo.getNumReady();
 }
\ No newline at end of file
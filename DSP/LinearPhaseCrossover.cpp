@@ -0,0 +1,567 @@
+/*
+  ==============================================================================
+
+    LinearPhaseCrossover.cpp
+    Created: 19 Oct 2026 9:12:40am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "LinearPhaseCrossover.h"
+
+namespace
+{
+    constexpr double kernelSeconds = 0.085;     // ~4096 taps at 44.1/48k, enough to resolve the lowest crossover
+    constexpr double crossfadeSeconds = 0.05;
+    constexpr int designerPollMs = 10;
+
+    int log2OfPowerOfTwo(int value)
+    {
+        int order = 0;
+        while ((1 << order) < value)
+            ++order;
+
+        return order;
+    }
+
+    int indexForPartitionSize(int partitionSize)
+    {
+        return log2OfPowerOfTwo(partitionSize / MIN_PARTITION_SIZE);
+    }
+
+    void multiplyAccumulate(const std::complex<float>* xSpectrum, const std::complex<float>* hSpectrum,
+        std::complex<float>* accSpectrum, int bins)
+    {
+        const auto* x = reinterpret_cast<const float*>(xSpectrum);
+        const auto* h = reinterpret_cast<const float*>(hSpectrum);
+        auto* acc = reinterpret_cast<float*>(accSpectrum);
+
+        for (int k = 0; k < 2 * bins; k += 2)
+        {
+            acc[k] += x[k] * h[k] - x[k + 1] * h[k + 1];
+            acc[k + 1] += x[k] * h[k + 1] + x[k + 1] * h[k];
+        }
+    }
+}
+
+//==============================================================================
+LinearPhaseKernelDesigner::LinearPhaseKernelDesigner()
+    : juce::Thread("Linear Phase Kernel Designer")
+{
+    startThread();
+}
+
+LinearPhaseKernelDesigner::~LinearPhaseKernelDesigner()
+{
+    stopThread(2000);
+}
+
+void LinearPhaseKernelDesigner::addClient(LinearPhaseCrossover* client)
+{
+    const juce::ScopedLock sl(clientLock);
+    clients.addIfNotAlreadyThere(client);
+    notify();
+}
+
+void LinearPhaseKernelDesigner::removeClient(LinearPhaseCrossover* client)
+{
+    // Taking the lock also waits for a design that is in flight for this client.
+    const juce::ScopedLock sl(clientLock);
+    clients.removeFirstMatchingValue(client);
+}
+
+void LinearPhaseKernelDesigner::run()
+{
+    while (!threadShouldExit())
+    {
+        {
+            const juce::ScopedLock sl(clientLock);
+            for (auto* client : clients)
+                client->designPendingKernels();
+        }
+
+        wait(designerPollMs);
+    }
+}
+
+//==============================================================================
+LinearPhaseCrossover::~LinearPhaseCrossover()
+{
+    designer->removeClient(this);
+}
+
+void LinearPhaseCrossover::prepare(const juce::dsp::ProcessSpec& spec, int newPartitionSize, float lowMidFreq, float midHighFreq)
+{
+    // Nothing here depends on the block size. At the same rate and channel count the running
+    // kernels and history are kept, new settings arrive through the setters like any other change.
+    if (prepared.load() && spec.sampleRate == sampleRate && static_cast<int>(spec.numChannels) == numChannels)
+    {
+        setPartitionSize(newPartitionSize);
+        setCrossoverFrequencies(lowMidFreq, midHighFreq);
+        return;
+    }
+
+    designer->removeClient(this);
+    prepared.store(false);
+
+    sampleRate = spec.sampleRate;
+    numChannels = static_cast<int>(spec.numChannels);
+    kernelLength = juce::jmax(MAX_PARTITION_SIZE, juce::nextPowerOfTwo(juce::roundToInt(sampleRate * kernelSeconds)));
+
+    // The smallest partition size needs the most bins; every other size fits in the same storage.
+    const auto maxBins = static_cast<size_t>((kernelLength / MIN_PARTITION_SIZE) * (MIN_PARTITION_SIZE + 1));
+
+    for (auto& set : kernelSets)
+    {
+        set.lowMidSpectra.assign(maxBins, {});
+        set.midHighSpectra.assign(maxBins, {});
+    }
+
+    const int directPathSize = juce::nextPowerOfTwo(MAX_PARTITION_SIZE + kernelLength);
+    directPathMask = directPathSize - 1;
+
+    channels.resize(static_cast<size_t>(numChannels));
+    for (auto& state : channels)
+    {
+        state.inputWindow.assign(2 * MAX_PARTITION_SIZE, 0.0f);
+        state.delayLine.assign(maxBins, {});
+        state.lowMidOutput.assign(MAX_PARTITION_SIZE, 0.0f);
+        state.midHighOutput.assign(MAX_PARTITION_SIZE, 0.0f);
+
+        for (auto* sum : { &state.lowMidSum, &state.midHighSum, &state.lowMidFadeSum, &state.midHighFadeSum })
+            sum->assign(MAX_PARTITION_SIZE + 1, {});
+
+        state.directPath.assign(static_cast<size_t>(directPathSize), 0.0);
+    }
+
+    for (int i = 0; i < NUM_PARTITION_SIZES; ++i)
+        ffts[i] = std::make_unique<juce::dsp::FFT>(log2OfPowerOfTwo(2 * getPartitionSizeForIndex(i)));
+
+    fftBuffer.assign(4 * MAX_PARTITION_SIZE, 0.0f);
+    fadeBuffer.assign(MAX_PARTITION_SIZE, 0.0f);
+
+    kernelScratch.assign(static_cast<size_t>(kernelLength), 0.0f);
+    designWindow.assign(static_cast<size_t>(kernelLength - 1), 0.0f);
+    designBuffer.assign(4 * MAX_PARTITION_SIZE, 0.0f);
+    juce::dsp::WindowingFunction<float>::fillWindowingTables(designWindow.data(), designWindow.size(),
+        juce::dsp::WindowingFunction<float>::blackman, false);
+
+    designKernelSet(kernelSets[0], newPartitionSize, lowMidFreq, midHighFreq);
+    designedPartitionSize = newPartitionSize;
+    designedLowMid = lowMidFreq;
+    designedMidHigh = midHighFreq;
+
+    requestedPartitionSize.store(newPartitionSize);
+    requestedLowMid.store(lowMidFreq);
+    requestedMidHigh.store(midHighFreq);
+
+    activeSlot = 0;
+    fadingSlot = -1;
+    busySlots.store(1 << activeSlot);
+    readySlot.store(-1);
+
+    configureForPartitionSize(newPartitionSize);
+
+    prepared.store(true);
+    designer->addClient(this);
+}
+
+void LinearPhaseCrossover::reset()
+{
+    for (auto& state : channels)
+    {
+        std::fill(state.inputWindow.begin(), state.inputWindow.end(), 0.0f);
+        std::fill(state.delayLine.begin(), state.delayLine.end(), std::complex<float>{});
+        std::fill(state.lowMidOutput.begin(), state.lowMidOutput.end(), 0.0f);
+        std::fill(state.midHighOutput.begin(), state.midHighOutput.end(), 0.0f);
+
+        for (auto* sum : { &state.lowMidSum, &state.midHighSum, &state.lowMidFadeSum, &state.midHighFadeSum })
+            std::fill(sum->begin(), sum->end(), std::complex<float>{});
+
+        std::fill(state.directPath.begin(), state.directPath.end(), 0.0);
+        state.directWriteIndex = 0;
+    }
+
+    blockPosition = 0;
+    delayLineIndex = 0;
+    outputsStale = false;
+    nextPartition = 1;
+}
+
+void LinearPhaseCrossover::setCrossoverFrequencies(float lowMidFreq, float midHighFreq)
+{
+    requestedLowMid.store(lowMidFreq);
+    requestedMidHigh.store(midHighFreq);
+}
+
+void LinearPhaseCrossover::setPartitionSize(int newPartitionSize)
+{
+    jassert(juce::isPowerOfTwo(newPartitionSize));
+    requestedPartitionSize.store(juce::jlimit(MIN_PARTITION_SIZE, MAX_PARTITION_SIZE, newPartitionSize));
+}
+
+//==============================================================================
+void LinearPhaseCrossover::designPendingKernels()
+{
+    if (!prepared.load() || readySlot.load(std::memory_order_acquire) >= 0)
+        return;
+
+    const float lowMid = requestedLowMid.load();
+    const float midHigh = requestedMidHigh.load();
+    const int newPartitionSize = requestedPartitionSize.load();
+
+    if (lowMid == designedLowMid && midHigh == designedMidHigh && newPartitionSize == designedPartitionSize)
+        return;
+
+    // Nothing new can be adopted until readySlot is published, so the busy slots cannot change under us
+    // except for a fade finishing, which only frees a slot.
+    const int busy = busySlots.load(std::memory_order_acquire);
+    int slot = 0;
+    while (slot < static_cast<int>(kernelSets.size()) && (busy & (1 << slot)) != 0)
+        ++slot;
+
+    jassert(slot < static_cast<int>(kernelSets.size()));
+    if (slot >= static_cast<int>(kernelSets.size()))
+        return;
+
+    designKernelSet(kernelSets[slot], newPartitionSize, lowMid, midHigh);
+    designedLowMid = lowMid;
+    designedMidHigh = midHigh;
+    designedPartitionSize = newPartitionSize;
+
+    readySlot.store(slot, std::memory_order_release);
+}
+
+void LinearPhaseCrossover::designLowpass(float cutoff)
+{
+    const int taps = kernelLength - 1;
+    const int centre = taps / 2;
+    const double normalisedCutoff = juce::jlimit(1.0, 0.45 * sampleRate, static_cast<double>(cutoff)) / sampleRate;
+
+    double sum = 0.0;
+    for (int n = 0; n < taps; ++n)
+    {
+        const double x = static_cast<double>(n - centre);
+        const double sinc = (n == centre)
+            ? 2.0 * normalisedCutoff
+            : std::sin(juce::MathConstants<double>::twoPi * normalisedCutoff * x) / (juce::MathConstants<double>::pi * x);
+
+        const double tap = sinc * designWindow[static_cast<size_t>(n)];
+        kernelScratch[static_cast<size_t>(n)] = static_cast<float>(tap);
+        sum += tap;
+    }
+
+    // unity gain at DC keeps low + mid + high summing to the delayed input
+    juce::FloatVectorOperations::multiply(kernelScratch.data(), static_cast<float>(1.0 / sum), taps);
+    kernelScratch[static_cast<size_t>(taps)] = 0.0f;
+}
+
+void LinearPhaseCrossover::designKernelSet(KernelSet& set, int newPartitionSize, float lowMidFreq, float midHighFreq)
+{
+    const int bins = newPartitionSize + 1;
+    juce::dsp::FFT designFFT(log2OfPowerOfTwo(2 * newPartitionSize));
+
+    set.partitionSize = newPartitionSize;
+    set.numPartitions = kernelLength / newPartitionSize;
+    set.lowMidFreq = lowMidFreq;
+    set.midHighFreq = midHighFreq;
+
+    auto partitionKernel = [&](std::vector<std::complex<float>>& spectra)
+        {
+            for (int p = 0; p < set.numPartitions; ++p)
+            {
+                std::fill(designBuffer.begin(), designBuffer.end(), 0.0f);
+                std::copy_n(kernelScratch.begin() + p * newPartitionSize, newPartitionSize, designBuffer.begin());
+
+                designFFT.performRealOnlyForwardTransform(designBuffer.data(), true);
+
+                auto* spectrum = reinterpret_cast<const std::complex<float>*>(designBuffer.data());
+                std::copy_n(spectrum, bins, spectra.begin() + p * bins);
+            }
+        };
+
+    designLowpass(lowMidFreq);
+    partitionKernel(set.lowMidSpectra);
+
+    designLowpass(midHighFreq);
+    partitionKernel(set.midHighSpectra);
+}
+
+//==============================================================================
+void LinearPhaseCrossover::configureForPartitionSize(int newPartitionSize)
+{
+    partitionSize = newPartitionSize;
+    numPartitions = kernelLength / partitionSize;
+    fft = ffts[indexForPartitionSize(partitionSize)].get();
+
+    fadeLength = juce::jmax(1, juce::roundToInt(sampleRate * crossfadeSeconds / partitionSize)) * partitionSize;
+    latencySamples.store(partitionSize + kernelLength / 2 - 1);
+
+    reset();
+}
+
+void LinearPhaseCrossover::adoptReadyKernels()
+{
+    if (fadingSlot >= 0)
+        return;
+
+    const int ready = readySlot.load(std::memory_order_acquire);
+    if (ready < 0)
+        return;
+
+    if (kernelSets[ready].partitionSize != partitionSize)
+    {
+        // A new partition size changes the latency, so there is nothing meaningful to crossfade against.
+        activeSlot = ready;
+        busySlots.store(1 << activeSlot, std::memory_order_release);
+        readySlot.store(-1, std::memory_order_release);
+        configureForPartitionSize(kernelSets[ready].partitionSize);
+        return;
+    }
+
+    fadingSlot = activeSlot;
+    activeSlot = ready;
+    fadePosition = 0;
+    busySlots.store((1 << activeSlot) | (1 << fadingSlot), std::memory_order_release);
+    readySlot.store(-1, std::memory_order_release);
+}
+
+template<typename SampleType>
+void LinearPhaseCrossover::process(const juce::AudioBuffer<SampleType>& input, std::array<juce::AudioBuffer<SampleType>, 3>& bands)
+{
+    jassert(prepared.load());
+
+    if (outputsStale)
+    {
+        // Nothing was accumulated while priming: convolve the newest partition in one go to get the
+        // outputs read out over the rest of this partition, then build the next block from scratch.
+        adoptReadyKernels();
+
+        for (int ch = 0; ch < juce::jmin(input.getNumChannels(), numChannels); ++ch)
+            convolveOutputs(channels[static_cast<size_t>(ch)]);
+
+        outputsStale = false;
+        nextPartition = 1;
+    }
+
+    const int numSamples = input.getNumSamples();
+    const int chans = juce::jmin(input.getNumChannels(), numChannels);
+    const int latency = latencySamples.load();
+
+    int processed = 0;
+    while (processed < numSamples)
+    {
+        const int count = juce::jmin(numSamples - processed, partitionSize - blockPosition);
+
+        for (int ch = 0; ch < chans; ++ch)
+        {
+            auto& state = channels[static_cast<size_t>(ch)];
+
+            const SampleType* in = input.getReadPointer(ch, processed);
+            SampleType* low = bands[0].getWritePointer(ch, processed);
+            SampleType* mid = bands[1].getWritePointer(ch, processed);
+            SampleType* high = bands[2].getWritePointer(ch, processed);
+
+            float* window = state.inputWindow.data() + partitionSize + blockPosition;
+            for (int i = 0; i < count; ++i)
+                window[i] = static_cast<float>(in[i]);
+
+            const float* lowMidOut = state.lowMidOutput.data() + blockPosition;
+            const float* midHighOut = state.midHighOutput.data() + blockPosition;
+
+            for (int i = 0; i < count; ++i)
+            {
+                state.directPath[static_cast<size_t>(state.directWriteIndex & directPathMask)] = in[i];
+                const auto delayed = static_cast<SampleType>(state.directPath[static_cast<size_t>((state.directWriteIndex - latency) & directPathMask)]);
+                ++state.directWriteIndex;
+
+                const auto lowMid = static_cast<SampleType>(lowMidOut[i]);
+                const auto midHigh = static_cast<SampleType>(midHighOut[i]);
+
+                low[i] = lowMid;
+                mid[i] = midHigh - lowMid;
+                high[i] = delayed - midHigh;
+            }
+        }
+
+        blockPosition += count;
+        processed += count;
+
+        if (blockPosition < partitionSize)
+        {
+            // this call's share of the partitions that only need input already in the delay line
+            const int target = 1 + (numPartitions - 1) * blockPosition / partitionSize;
+            if (target > nextPartition)
+            {
+                for (int ch = 0; ch < chans; ++ch)
+                    accumulatePartitions(channels[static_cast<size_t>(ch)], delayLineIndex + 1, nextPartition, target);
+
+                nextPartition = target;
+            }
+
+            continue;
+        }
+
+        delayLineIndex = (delayLineIndex + 1) % numPartitions;
+
+        for (int ch = 0; ch < chans; ++ch)
+        {
+            auto& state = channels[static_cast<size_t>(ch)];
+            transformInput(state);
+            accumulatePartitions(state, delayLineIndex, nextPartition, numPartitions);
+            accumulatePartitions(state, delayLineIndex, 0, 1);
+            finishOutputs(state);
+        }
+
+        blockPosition = 0;
+        nextPartition = 1;
+
+        if (fadingSlot >= 0)
+        {
+            fadePosition += partitionSize;
+            if (fadePosition >= fadeLength)
+            {
+                fadingSlot = -1;
+                busySlots.store(1 << activeSlot, std::memory_order_release);
+            }
+        }
+
+        // kernels only change between partitions, every partial sum above used the same ones
+        adoptReadyKernels();
+    }
+}
+
+template void LinearPhaseCrossover::process<float>(const juce::AudioBuffer<float>&, std::array<juce::AudioBuffer<float>, 3>&);
+template void LinearPhaseCrossover::process<double>(const juce::AudioBuffer<double>&, std::array<juce::AudioBuffer<double>, 3>&);
+
+template<typename SampleType>
+void LinearPhaseCrossover::prime(const juce::AudioBuffer<SampleType>& input)
+{
+    jassert(prepared.load());
+
+    const int numSamples = input.getNumSamples();
+    const int chans = juce::jmin(input.getNumChannels(), numChannels);
+
+    int processed = 0;
+    while (processed < numSamples)
+    {
+        const int count = juce::jmin(numSamples - processed, partitionSize - blockPosition);
+
+        for (int ch = 0; ch < chans; ++ch)
+        {
+            auto& state = channels[static_cast<size_t>(ch)];
+            const SampleType* in = input.getReadPointer(ch, processed);
+
+            float* window = state.inputWindow.data() + partitionSize + blockPosition;
+            for (int i = 0; i < count; ++i)
+            {
+                window[i] = static_cast<float>(in[i]);
+                state.directPath[static_cast<size_t>(state.directWriteIndex++ & directPathMask)] = in[i];
+            }
+        }
+
+        blockPosition += count;
+        processed += count;
+
+        if (blockPosition == partitionSize)
+        {
+            delayLineIndex = (delayLineIndex + 1) % numPartitions;
+
+            for (int ch = 0; ch < chans; ++ch)
+                transformInput(channels[static_cast<size_t>(ch)]);
+
+            blockPosition = 0;
+            outputsStale = true;
+        }
+    }
+}
+
+template void LinearPhaseCrossover::prime<float>(const juce::AudioBuffer<float>&);
+template void LinearPhaseCrossover::prime<double>(const juce::AudioBuffer<double>&);
+
+void LinearPhaseCrossover::transformInput(ChannelState& state)
+{
+    const int bins = partitionSize + 1;
+
+    std::copy_n(state.inputWindow.begin(), 2 * partitionSize, fftBuffer.begin());
+    fft->performRealOnlyForwardTransform(fftBuffer.data(), true);
+
+    auto* spectrum = reinterpret_cast<const std::complex<float>*>(fftBuffer.data());
+    std::copy_n(spectrum, bins, state.delayLine.begin() + delayLineIndex * bins);
+
+    // slide the window so the block just consumed becomes the overlap half
+    std::copy_n(state.inputWindow.begin() + partitionSize, partitionSize, state.inputWindow.begin());
+}
+
+void LinearPhaseCrossover::accumulatePartitions(ChannelState& state, int newest, int firstPartition, int endPartition)
+{
+    const int bins = partitionSize + 1;
+
+    const auto& active = kernelSets[static_cast<size_t>(activeSlot)];
+    const auto* fading = fadingSlot >= 0 ? &kernelSets[static_cast<size_t>(fadingSlot)] : nullptr;
+
+    for (int p = firstPartition; p < endPartition; ++p)
+    {
+        // partition p of the kernel meets the input spectrum from p blocks before the newest
+        const int slot = (newest - p + 2 * numPartitions) % numPartitions;
+        const auto* x = state.delayLine.data() + slot * bins;
+
+        multiplyAccumulate(x, active.lowMidSpectra.data() + p * bins, state.lowMidSum.data(), bins);
+        multiplyAccumulate(x, active.midHighSpectra.data() + p * bins, state.midHighSum.data(), bins);
+
+        if (fading != nullptr)
+        {
+            multiplyAccumulate(x, fading->lowMidSpectra.data() + p * bins, state.lowMidFadeSum.data(), bins);
+            multiplyAccumulate(x, fading->midHighSpectra.data() + p * bins, state.midHighFadeSum.data(), bins);
+        }
+    }
+}
+
+void LinearPhaseCrossover::finishOutputs(ChannelState& state)
+{
+    const int bins = partitionSize + 1;
+
+    auto inverse = [this, bins](std::vector<std::complex<float>>& sum, float* output)
+        {
+            std::copy_n(reinterpret_cast<const float*>(sum.data()), 2 * bins, fftBuffer.begin());
+            std::fill_n(sum.begin(), bins, std::complex<float>{});
+
+            fft->performRealOnlyInverseTransform(fftBuffer.data());
+
+            // overlap-save: only the second half of the circular convolution is valid
+            std::copy_n(fftBuffer.begin() + partitionSize, partitionSize, output);
+        };
+
+    auto finishWithFade = [&](std::vector<std::complex<float>>& activeSum, std::vector<std::complex<float>>& fadeSum,
+        std::vector<float>& output)
+        {
+            inverse(activeSum, output.data());
+
+            if (fadingSlot < 0)
+                return;
+
+            inverse(fadeSum, fadeBuffer.data());
+
+            const float step = 1.0f / static_cast<float>(fadeLength);
+            for (int i = 0; i < partitionSize; ++i)
+            {
+                const float amount = static_cast<float>(fadePosition + i) * step;
+                output[static_cast<size_t>(i)] = fadeBuffer[static_cast<size_t>(i)]
+                    + amount * (output[static_cast<size_t>(i)] - fadeBuffer[static_cast<size_t>(i)]);
+            }
+        };
+
+    finishWithFade(state.lowMidSum, state.lowMidFadeSum, state.lowMidOutput);
+    finishWithFade(state.midHighSum, state.midHighFadeSum, state.midHighOutput);
+}
+
+void LinearPhaseCrossover::convolveOutputs(ChannelState& state)
+{
+    // the whole convolution at once, for when nothing was accumulated ahead of time
+    for (auto* sum : { &state.lowMidSum, &state.midHighSum, &state.lowMidFadeSum, &state.midHighFadeSum })
+        std::fill(sum->begin(), sum->end(), std::complex<float>{});
+
+    accumulatePartitions(state, delayLineIndex, 0, numPartitions);
+    finishOutputs(state);
+}
@@ -0,0 +1,172 @@
+/*
+  ==============================================================================
+
+    LinearPhaseCrossover.h
+    Created: 19 Oct 2026 9:12:40am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <complex>
+#include <vector>
+#include "Constants.h"
+
+struct LinearPhaseCrossover;
+
+/*
+    One background thread shared by every LinearPhaseCrossover in the process.
+    It polls its clients and designs new kernels whenever a crossover moved, so
+    the audio thread never does more than a few atomic stores to request one.
+*/
+struct LinearPhaseKernelDesigner : juce::Thread
+{
+    LinearPhaseKernelDesigner();
+    ~LinearPhaseKernelDesigner() override;
+
+    void addClient(LinearPhaseCrossover* client);
+    void removeClient(LinearPhaseCrossover* client);
+
+    void run() override;
+
+private:
+    juce::CriticalSection clientLock;
+    juce::Array<LinearPhaseCrossover*> clients;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearPhaseKernelDesigner)
+};
+
+/*
+    Three band linear phase crossover built on uniformly partitioned FFT
+    convolution (overlap-save, frequency domain delay line).
+
+    Two windowed-sinc lowpass kernels are convolved with the input:
+        low  = x * lp(lowMid)
+        mid  = x * lp(midHigh) - low
+        high = delay(x) - x * lp(midHigh)
+    so the three bands always sum back to the delayed input.
+
+    Only the terms that need the newest input wait for the partition boundary:
+    every kernel partition but the first meets input that is already in the
+    delay line, so those products are accumulated a slice at a time as samples
+    arrive, in proportion to how far into the partition each call gets. A call
+    therefore costs its share of the multiply-accumulates plus, if it crosses a
+    boundary, one forward FFT, one partition's products and two inverse FFTs
+    per channel, whatever the partition size. While a crossfade to freshly
+    designed kernels is running the kernel work doubles, and never more,
+    because new kernels are only adopted on a boundary once the previous fade
+    has finished.
+*/
+struct LinearPhaseCrossover
+{
+    LinearPhaseCrossover() = default;
+    ~LinearPhaseCrossover();
+
+    /** Allocates for every supported partition size and designs the initial kernels on the calling thread.
+        Kernels are sample rate specific, so only a new rate or channel count starts over. */
+    void prepare(const juce::dsp::ProcessSpec& spec, int partitionSize, float lowMidFreq, float midHighFreq);
+    void reset();
+
+    /** Audio thread: request new crossover points / partition size. Kernels are designed in the background. */
+    void setCrossoverFrequencies(float lowMidFreq, float midHighFreq);
+    void setPartitionSize(int partitionSize);
+
+    /** The convolution itself runs in float (juce::dsp::FFT is float only); the dry path keeps full precision. */
+    template<typename SampleType>
+    void process(const juce::AudioBuffer<SampleType>& input, std::array<juce::AudioBuffer<SampleType>, 3>& bands);
+
+    /** Audio thread, while the other crossover is in use: keeps the input history and the frequency
+        domain delay line current (one forward FFT per partition, no convolution), so process() can
+        take over on any sample. The first process() after priming convolves the newest partition once. */
+    template<typename SampleType>
+    void prime(const juce::AudioBuffer<SampleType>& input);
+
+    /** Latency of the kernels currently in use: one partition plus half the kernel length. */
+    int getLatencySamples() const { return latencySamples.load(); }
+
+    /** Latency at the largest partition size, the most any other path has to be delayed by. */
+    int getMaxLatencySamples() const { return MAX_PARTITION_SIZE + kernelLength / 2 - 1; }
+
+    static int getPartitionSizeForIndex(int index) { return MIN_PARTITION_SIZE << index; }
+
+private:
+    friend struct LinearPhaseKernelDesigner;
+
+    struct KernelSet
+    {
+        int partitionSize{ 0 };
+        int numPartitions{ 0 };
+        float lowMidFreq{ 0.0f };
+        float midHighFreq{ 0.0f };
+
+        // numPartitions * (partitionSize + 1) bins each
+        std::vector<std::complex<float>> lowMidSpectra, midHighSpectra;
+    };
+
+    struct ChannelState
+    {
+        std::vector<float> inputWindow;                 // 2 * partition size, [previous block | current block]
+        std::vector<std::complex<float>> delayLine;     // frequency domain delay line, numPartitions spectra
+        std::vector<std::complex<float>> lowMidSum, midHighSum;         // next block's spectra, built up across the partition
+        std::vector<std::complex<float>> lowMidFadeSum, midHighFadeSum; // the same for the kernels being faded out
+        std::vector<float> lowMidOutput, midHighOutput; // last convolved block, read out over the next block
+        std::vector<double> directPath;                 // delays the dry input to line up with the kernels
+        int directWriteIndex{ 0 };
+    };
+
+    void designPendingKernels();
+    void designKernelSet(KernelSet& set, int partitionSize, float lowMidFreq, float midHighFreq);
+    void designLowpass(float cutoff);
+
+    void adoptReadyKernels();
+    void configureForPartitionSize(int partitionSize);
+    void transformInput(ChannelState& state);
+    void accumulatePartitions(ChannelState& state, int newest, int firstPartition, int endPartition);
+    void finishOutputs(ChannelState& state);
+    void convolveOutputs(ChannelState& state);
+
+    juce::SharedResourcePointer<LinearPhaseKernelDesigner> designer;
+
+    double sampleRate{ 44100.0 };
+    int kernelLength{ 0 };
+    int numChannels{ 0 };
+
+    // kernel hand-off: designer writes into a free slot and publishes it via readySlot
+    std::array<KernelSet, 3> kernelSets;
+    std::atomic<int> readySlot{ -1 };
+    std::atomic<int> busySlots{ 0 };
+    int activeSlot{ -1 };
+    int fadingSlot{ -1 };
+    int fadePosition{ 0 };
+    int fadeLength{ 0 };
+
+    std::atomic<float> requestedLowMid{ 0.0f }, requestedMidHigh{ 0.0f };
+    std::atomic<int> requestedPartitionSize{ 0 };
+    float designedLowMid{ 0.0f }, designedMidHigh{ 0.0f };
+    int designedPartitionSize{ 0 };
+    std::atomic<bool> prepared{ false };
+
+    // audio thread layout for the active partition size
+    int partitionSize{ 0 };
+    int numPartitions{ 0 };
+    int blockPosition{ 0 };
+    int delayLineIndex{ 0 };        // newest spectrum in the delay line
+    bool outputsStale{ false };     // primed since the last convolution
+    int nextPartition{ 1 };         // first kernel partition not yet accumulated for the next block
+    int directPathMask{ 0 };
+    std::atomic<int> latencySamples{ 0 };
+
+    std::vector<ChannelState> channels;
+    std::array<std::unique_ptr<juce::dsp::FFT>, NUM_PARTITION_SIZES> ffts;
+    juce::dsp::FFT* fft{ nullptr };
+    std::vector<float> fftBuffer, fadeBuffer;
+
+    // designer thread scratch
+    std::vector<float> kernelScratch, designWindow, designBuffer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LinearPhaseCrossover)
+};
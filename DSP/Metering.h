@@ -0,0 +1,41 @@
+/*
+  ==============================================================================
+
+    Metering.h
+    Created: 19 Oct 2026 4:26:05pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include "Constants.h"
+
+/*
+    One meter period (1 / METER_RATE_HZ seconds) of a band, per channel.
+    Levels are taken from the band after compression; gain reduction is the
+    deepest reduction reached during the period, as a positive dB amount.
+*/
+struct BandMeter
+{
+    int numChannels{ 0 };
+    std::array<float, MAX_CHANNELS> peakDb{};
+    std::array<float, MAX_CHANNELS> rmsDb{};
+    std::array<float, MAX_CHANNELS> gainReductionDb{};
+
+    float getMaxGainReductionDb() const
+    {
+        float maxGR = 0.0f;
+        for (int ch = 0; ch < numChannels; ++ch)
+            maxGR = juce::jmax(maxGR, gainReductionDb[ch]);
+        return maxGR;
+    }
+};
+
+// every band for the same meter period, what the audio thread publishes
+struct MeterFrame
+{
+    std::array<BandMeter, 3> bands;
+};
@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    MidSideCodec.h
+    Created: 19 Oct 2026 3:12:48pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+/*
+    Stereo <-> mid/side conversion, in place on channels 0 and 1.
+
+        M = (L + R) / 2        L = M + S
+        S = (L - R) / 2        R = M - S
+
+    Each is a single pass of independent per-sample operations with no
+    aliasing between the two channel pointers, so the loops vectorise.
+*/
+namespace MidSideCodec
+{
+    template<typename SampleType>
+    inline void encode(juce::AudioBuffer<SampleType>& buffer, int numSamples)
+    {
+        jassert(buffer.getNumChannels() >= 2);
+
+        SampleType* JUCE_RESTRICT left = buffer.getWritePointer(0);
+        SampleType* JUCE_RESTRICT right = buffer.getWritePointer(1);
+        const auto half = static_cast<SampleType>(0.5);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const SampleType mid = (left[i] + right[i]) * half;
+            const SampleType side = (left[i] - right[i]) * half;
+            left[i] = mid;
+            right[i] = side;
+        }
+    }
+
+    template<typename SampleType>
+    inline void decode(juce::AudioBuffer<SampleType>& buffer, int numSamples)
+    {
+        jassert(buffer.getNumChannels() >= 2);
+
+        SampleType* JUCE_RESTRICT mid = buffer.getWritePointer(0);
+        SampleType* JUCE_RESTRICT side = buffer.getWritePointer(1);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const SampleType left = mid[i] + side[i];
+            const SampleType right = mid[i] - side[i];
+            mid[i] = left;
+            side[i] = right;
+        }
+    }
+}
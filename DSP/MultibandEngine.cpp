@@ -0,0 +1,520 @@
+/*
+  ==============================================================================
+
+    MultibandEngine.cpp
+    Created: 19 Oct 2026 11:02:15am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "MultibandEngine.h"
+
+template<typename SampleType>
+MultibandEngine<SampleType>::MultibandEngine()
+{
+    channelGroups.fill(FrontGroup);
+    linkGroups.fill(-1);
+    unlinkedGroups.fill(-1);
+    bandStereoModes.fill(StereoMode::LeftRight);
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::setChannelLayout(const juce::AudioChannelSet& layout)
+{
+    using CT = juce::AudioChannelSet::ChannelType;
+
+    channelGroups.fill(OtherGroup);
+
+    for (int ch = 0; ch < juce::jmin(layout.size(), MAX_CHANNELS); ++ch)
+    {
+        switch (layout.getTypeOfChannel(ch))
+        {
+        case CT::left:
+        case CT::right:
+        case CT::centre:
+        case CT::leftCentre:
+        case CT::rightCentre:
+        case CT::wideLeft:
+        case CT::wideRight:
+            channelGroups[ch] = FrontGroup;
+            break;
+
+        case CT::leftSurround:
+        case CT::rightSurround:
+        case CT::centreSurround:
+        case CT::leftSurroundSide:
+        case CT::rightSurroundSide:
+        case CT::leftSurroundRear:
+        case CT::rightSurroundRear:
+            channelGroups[ch] = SurroundGroup;
+            break;
+
+        default:
+            channelGroups[ch] = OtherGroup;
+            break;
+        }
+    }
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    jassert(spec.numChannels <= MAX_CHANNELS);
+    numChannels = juce::jmin(static_cast<int>(spec.numChannels), MAX_CHANNELS);
+
+    // everything below processes at most one sub-block at a time
+    auto subBlockSpec = spec;
+    subBlockSpec.maximumBlockSize = ENGINE_SUB_BLOCK_SIZE;
+
+    for (auto& comp : compressorArray)
+        comp.prepare(subBlockSpec);
+
+    crossover.prepare(subBlockSpec);
+
+    linearPhaseCrossover.prepare(subBlockSpec,
+        LinearPhaseCrossover::getPartitionSizeForIndex(linearPhasePartitionSize->getIndex()),
+        lowMidCrossover->get(),
+        midHighCrossover->get());
+
+    lastCrossoverMode = crossoverMode->getIndex();
+
+    inputGain.prepare(subBlockSpec);
+    outputGain.prepare(subBlockSpec);
+
+    inputGain.setRampDurationSeconds(0.05); // 50ms
+    outputGain.setRampDurationSeconds(0.05); // 50ms
+
+    // Re-preparing keeps what is still valid: storage is only reallocated when it has to grow
+    // and the dry delay keeps its history unless its length or channel count changed.
+    for (auto& buffer : filterBufferArray)
+    {
+        buffer.setSize(spec.numChannels, ENGINE_SUB_BLOCK_SIZE, false, false, true);
+    }
+
+    for (auto& buffer : transitionBufferArray)
+    {
+        buffer.setSize(spec.numChannels, ENGINE_SUB_BLOCK_SIZE, false, false, true);
+    }
+
+    crossoverFadeLength = juce::jmax(1, juce::roundToInt(CROSSOVER_FADE_MS * 0.001 * spec.sampleRate));
+    crossoverFadePosition = lastCrossoverMode == CrossoverMode::LinearPhase ? crossoverFadeLength : 0;
+
+    const int delaySize = linearPhaseCrossover.getMaxLatencySamples() + ENGINE_SUB_BLOCK_SIZE;
+    if (dryDelayBuffer.getNumChannels() != static_cast<int>(spec.numChannels) || dryDelayBuffer.getNumSamples() != delaySize)
+    {
+        dryDelayBuffer.setSize(spec.numChannels, delaySize, false, false, true);
+        dryDelayBuffer.clear();
+        dryWritePosition = 0;
+    }
+
+    dryBuffer.setSize(spec.numChannels, ENGINE_SUB_BLOCK_SIZE, false, false, true);
+    dryTransitionBuffer.setSize(spec.numChannels, ENGINE_SUB_BLOCK_SIZE, false, false, true);
+
+    fadePeriods = juce::jmax(1, juce::roundToInt(BAND_FADE_MS * 0.001 * spec.sampleRate / ENGINE_SUB_BLOCK_SIZE));
+
+    // start the first period at the current settings instead of fading up from silence
+    subBlockPosition = 0;
+    updateState();
+
+    for (size_t i = 0; i < bandFades.size(); ++i)
+    {
+        bandFades[i].snap();
+        bandGainsFrom[i] = bandGainsTo[i] = bandFades[i].current;
+    }
+
+    dryFade.snap();
+    dryGainFrom = dryGainTo = dryFade.current;
+    runningBands = audibleBands;
+}
+
+template<typename SampleType>
+int MultibandEngine<SampleType>::getLatencySamples() const
+{
+    return lastCrossoverMode == CrossoverMode::LinearPhase
+        ? linearPhaseCrossover.getLatencySamples()
+        : 0;
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::updateState()
+{
+    for (auto& comp : compressorArray)
+    {
+        comp.updateCompressorSettings();
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const int group = channelGroups[ch];
+        linkGroups[ch] = linkGroupParams[group]->get() ? group : -1;
+    }
+
+    midSideActive = false;
+    for (size_t i = 0; i < compressorArray.size(); ++i)
+    {
+        bandStereoModes[i] = numChannels == 2 ? compressorArray[i].stereoMode->getIndex() : StereoMode::LeftRight;
+        midSideActive = midSideActive || bandStereoModes[i] != StereoMode::LeftRight;
+    }
+
+    for (size_t i = 0; i < compressorArray.size(); ++i)
+    {
+        auto& comp = compressorArray[i];
+        const int mode = bandStereoModes[i];
+
+        // mid and side are detected separately, linking them would undo the point of M/S
+        comp.setLinkGroups(mode == StereoMode::LeftRight ? linkGroups.data() : unlinkedGroups.data());
+        comp.setChannelMask(mode == StereoMode::MidOnly ? 0x1
+            : mode == StereoMode::SideOnly ? 0x2
+            : 0xffffffff);
+    }
+
+    auto lowMidCutOffFreq = lowMidCrossover->get();
+    auto midHighCutoffFreq = midHighCrossover->get();
+    crossover.setCrossoverFrequencies(lowMidCutOffFreq, midHighCutoffFreq);
+
+    // the kernel designer only hears about changes it will actually be used for
+    lastCrossoverMode = crossoverMode->getIndex();
+    if (lastCrossoverMode == CrossoverMode::LinearPhase)
+    {
+        linearPhaseCrossover.setCrossoverFrequencies(lowMidCutOffFreq, midHighCutoffFreq);
+        linearPhaseCrossover.setPartitionSize(
+            LinearPhaseCrossover::getPartitionSizeForIndex(linearPhasePartitionSize->getIndex()));
+    }
+
+    inputGain.setGainDecibels(inputGainParam->get());
+    outputGain.setGainDecibels(outputGainParam->get());
+
+    // any solo overrides every mute
+    juce::uint32 soloMask = 0, muteMask = 0;
+    for (size_t i = 0; i < compressorArray.size(); ++i)
+    {
+        soloMask |= static_cast<juce::uint32>(compressorArray[i].solo->get()) << i;
+        muteMask |= static_cast<juce::uint32>(compressorArray[i].mute->get()) << i;
+    }
+
+    audibleBands = soloMask != 0 ? soloMask : (~muteMask & 0x7);
+    runningBands = audibleBands;
+
+    // Makeup, routing and the global wet level are folded into one gain per band.
+    // Each period ramps from the previous period's value to the next step of its fade.
+    const auto wet = static_cast<SampleType>(mixParam->get() / 100.0f);
+    for (size_t i = 0; i < compressorArray.size(); ++i)
+    {
+        const auto routing = static_cast<SampleType>((audibleBands >> i) & 1u);
+
+        bandGainsFrom[i] = bandGainsTo[i];
+        bandGainsTo[i] = bandFades[i].advance(compressorArray[i].getMakeupGain() * wet * routing, fadePeriods);
+
+        // a band still fading out keeps running until it is silent
+        if (bandGainsFrom[i] != SampleType(0) || bandGainsTo[i] != SampleType(0))
+            runningBands |= 1u << i;
+    }
+
+    dryGainFrom = dryGainTo;
+    dryGainTo = dryFade.advance(SampleType(1) - wet, fadePeriods);
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::publishMeters()
+{
+    if (meterFifo == nullptr || !meteringEnabled)
+        return;
+
+    // every band saw the same samples, so they closed the same meter periods
+    const int numMeters = compressorArray[0].getNumCompletedMeters();
+
+    for (int m = 0; m < numMeters; ++m)
+    {
+        for (size_t band = 0; band < compressorArray.size(); ++band)
+            meterFrame.bands[band] = compressorArray[band].getCompletedMeter(m);
+
+        meterFifo->push(meterFrame);
+    }
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::pushDrySignal(const juce::AudioBuffer<SampleType>& buffer)
+{
+    const int delaySize = dryDelayBuffer.getNumSamples();
+    const int numSamples = buffer.getNumSamples();
+    const int firstPart = juce::jmin(numSamples, delaySize - dryWritePosition);
+
+    for (int ch = 0; ch < dryDelayBuffer.getNumChannels(); ++ch)
+    {
+        dryDelayBuffer.copyFrom(ch, dryWritePosition, buffer, ch, 0, firstPart);
+        if (firstPart < numSamples)
+            dryDelayBuffer.copyFrom(ch, 0, buffer, ch, firstPart, numSamples - firstPart);
+    }
+
+    dryWritePosition = (dryWritePosition + numSamples) % delaySize;
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::readDrySignal(int latency, int numSamples, juce::AudioBuffer<SampleType>& destination)
+{
+    // the block just pushed ends at dryWritePosition, step back over it and the latency
+    const int delaySize = dryDelayBuffer.getNumSamples();
+    jassert(latency + numSamples <= delaySize);
+
+    const int readPosition = (dryWritePosition - numSamples - latency + 2 * delaySize) % delaySize;
+    const int firstPart = juce::jmin(numSamples, delaySize - readPosition);
+
+    for (int ch = 0; ch < destination.getNumChannels(); ++ch)
+    {
+        destination.copyFrom(ch, 0, dryDelayBuffer, ch, readPosition, firstPart);
+        if (firstPart < numSamples)
+            destination.copyFrom(ch, firstPart, dryDelayBuffer, ch, 0, numSamples - firstPart);
+    }
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::splitBands(const juce::AudioBuffer<SampleType>& inputBuffer)
+{
+    MBCOMP_TRACE_SCOPE("MultibandEngine::splitBands");
+
+    // Both crossovers write every sample of every band, the band buffers need no initialising.
+    // A switch crossfades the two outputs, which have different latencies; the dry path is
+    // read at both and faded along the same ramp, so whatever the mix, dry and wet comb
+    // against each other no more than the wet path already does with itself mid fade.
+    const bool toLinearPhase = lastCrossoverMode == CrossoverMode::LinearPhase;
+    const int fadeEnd = toLinearPhase ? crossoverFadeLength : 0;
+
+    crossoverFadeStart = crossoverFadePosition;
+    crossoverFading = crossoverFadePosition != fadeEnd;
+
+    if (!crossoverFading)
+    {
+        if (toLinearPhase)
+        {
+            // keeps the Linkwitz-Riley filter state current for the way back
+            crossover.process(inputBuffer, transitionBufferArray);
+            linearPhaseCrossover.process(inputBuffer, filterBufferArray);
+        }
+        else
+        {
+            crossover.process(inputBuffer, filterBufferArray);
+            linearPhaseCrossover.prime(inputBuffer);
+        }
+
+        return;
+    }
+
+    crossover.process(inputBuffer, transitionBufferArray);
+    linearPhaseCrossover.process(inputBuffer, filterBufferArray);
+
+    const int numSamples = inputBuffer.getNumSamples();
+
+    for (size_t band = 0; band < filterBufferArray.size(); ++band)
+    {
+        for (int ch = 0; ch < filterBufferArray[band].getNumChannels(); ++ch)
+            blendCrossoverFade(filterBufferArray[band].getWritePointer(ch), transitionBufferArray[band].getReadPointer(ch), numSamples);
+    }
+
+    const int direction = toLinearPhase ? 1 : -1;
+    crossoverFadePosition = juce::jlimit(0, crossoverFadeLength, crossoverFadePosition + direction * numSamples);
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::blendCrossoverFade(SampleType* linearPhase, const SampleType* linkwitzRiley, int numSamples) const
+{
+    const bool toLinearPhase = lastCrossoverMode == CrossoverMode::LinearPhase;
+    const int fadeEnd = toLinearPhase ? crossoverFadeLength : 0;
+    const int direction = toLinearPhase ? 1 : -1;
+    const auto scale = SampleType(1) / static_cast<SampleType>(crossoverFadeLength);
+
+    int position = crossoverFadeStart;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        if (position != fadeEnd)
+            position += direction;
+
+        const auto amount = static_cast<SampleType>(position) * scale;
+        linearPhase[i] = linkwitzRiley[i] + amount * (linearPhase[i] - linkwitzRiley[i]);
+    }
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::sumBands(juce::AudioBuffer<SampleType>& buffer, const std::array<SampleType, 3>& startGains,
+    const std::array<SampleType, 3>& endGains, bool accumulate)
+{
+    const int numSamples = buffer.getNumSamples();
+    const auto length = static_cast<SampleType>(numSamples);
+
+    const SampleType g0 = startGains[0], g1 = startGains[1], g2 = startGains[2];
+    const SampleType step0 = (endGains[0] - g0) / length;
+    const SampleType step1 = (endGains[1] - g1) / length;
+    const SampleType step2 = (endGains[2] - g2) / length;
+
+    // Silent bands are summed at zero gain rather than branched around, so each
+    // channel is one straight multiply-accumulate loop the compiler can vectorise.
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    {
+        const SampleType* low = filterBufferArray[0].getReadPointer(ch);
+        const SampleType* mid = filterBufferArray[1].getReadPointer(ch);
+        const SampleType* high = filterBufferArray[2].getReadPointer(ch);
+        SampleType* out = buffer.getWritePointer(ch);
+
+        auto bandSum = [&](int i)
+            {
+                const auto n = static_cast<SampleType>(i);
+                return (g0 + step0 * n) * low[i] + (g1 + step1 * n) * mid[i] + (g2 + step2 * n) * high[i];
+            };
+
+        if (accumulate)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                out[i] += bandSum(i);
+        }
+        else
+        {
+            for (int i = 0; i < numSamples; ++i)
+                out[i] = bandSum(i);
+        }
+    }
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::process(juce::AudioBuffer<SampleType>& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
+
+    // Sub-blocks are aligned to the stream rather than to the host block, so the
+    // control-rate updates land on the same samples whatever the host sends.
+    for (int start = 0; start < numSamples;)
+    {
+        if (subBlockPosition == 0)
+            updateState();
+
+        const int count = juce::jmin(numSamples - start, ENGINE_SUB_BLOCK_SIZE - subBlockPosition);
+
+        // refers to the host's channels, no copy and no allocation below MAX_CHANNELS
+        juce::AudioBuffer<SampleType> subBlock(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), start, count);
+        processSubBlock(subBlock);
+
+        subBlockPosition = (subBlockPosition + count) % ENGINE_SUB_BLOCK_SIZE;
+        start += count;
+    }
+}
+
+template<typename SampleType>
+void MultibandEngine<SampleType>::processSubBlock(juce::AudioBuffer<SampleType>& buffer)
+{
+    {
+        MBCOMP_PROFILE_STAGE(performanceMonitor, InputGainStage);
+        applyGain(buffer, inputGain);
+    }
+
+    int numSamples = buffer.getNumSamples();
+    int numChannels = buffer.getNumChannels();
+
+    {
+        MBCOMP_PROFILE_STAGE(performanceMonitor, SplitStage);
+
+        // storage was allocated for a full sub-block in prepare, this only moves the channel pointers
+        for (auto& filterBuffer : filterBufferArray)
+            filterBuffer.setSize(numChannels, numSamples, false, false, true);
+
+        for (auto& transitionBuffer : transitionBufferArray)
+            transitionBuffer.setSize(numChannels, numSamples, false, false, true);
+
+        pushDrySignal(buffer);
+
+        // Encode once ahead of the (linear) band split, so every band comes out in M/S.
+        // Left/right bands are decoded back before compression and summed after the
+        // M/S bands have been decoded as a whole.
+        if (midSideActive)
+            MidSideCodec::encode(buffer, numSamples);
+
+        splitBands(buffer);
+    }
+
+    for (size_t i = 0; i < filterBufferArray.size(); ++i)
+    {
+        MBCOMP_PROFILE_STAGE(performanceMonitor, static_cast<ProfileStage>(CompressLowStage + i));
+
+        if (midSideActive && bandStereoModes[i] == StereoMode::LeftRight)
+            MidSideCodec::decode(filterBufferArray[i], numSamples);
+
+        // a silent band still feeds its envelope, so unmuting does not let a transient through
+        if ((runningBands & (1u << i)) == 0)
+        {
+            compressorArray[i].skip(filterBufferArray[i]);
+            continue;
+        }
+
+        compressorArray[i].process(filterBufferArray[i]);
+    }
+
+    publishMeters();
+
+    {
+        MBCOMP_PROFILE_STAGE(performanceMonitor, SumStage);
+
+        // The gains set in updateState ramp across the whole sub-block period,
+        // a period split over two host blocks continues the same ramp.
+        auto gainAt = [](SampleType from, SampleType to, int position)
+            {
+                return from + (to - from) * static_cast<SampleType>(position) / static_cast<SampleType>(ENGINE_SUB_BLOCK_SIZE);
+            };
+
+        const int rampStart = subBlockPosition;
+        const int rampEnd = subBlockPosition + numSamples;
+
+        // the dry path is read back at whatever latency the split just ran with
+        const bool dryIsAudible = dryGainFrom > SampleType(0) || dryGainTo > SampleType(0);
+
+        if (dryIsAudible && crossoverFading)
+        {
+            // Linkwitz-Riley has no latency, the dry path fades from one alignment to the other
+            readDrySignal(linearPhaseCrossover.getLatencySamples(), numSamples, dryBuffer);
+            readDrySignal(0, numSamples, dryTransitionBuffer);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                blendCrossoverFade(dryBuffer.getWritePointer(ch), dryTransitionBuffer.getReadPointer(ch), numSamples);
+        }
+        else if (dryIsAudible)
+        {
+            readDrySignal(getLatencySamples(), numSamples, dryBuffer);
+        }
+
+        // M/S bands first, decoded together, then the bands that are already left/right
+        std::array<SampleType, 3> midSideStart{}, midSideEnd{}, leftRightStart{}, leftRightEnd{};
+
+        for (size_t i = 0; i < compressorArray.size(); ++i)
+        {
+            const bool isLeftRight = !midSideActive || bandStereoModes[i] == StereoMode::LeftRight;
+            auto& start = isLeftRight ? leftRightStart : midSideStart;
+            auto& end = isLeftRight ? leftRightEnd : midSideEnd;
+
+            start[i] = gainAt(bandGainsFrom[i], bandGainsTo[i], rampStart);
+            end[i] = gainAt(bandGainsFrom[i], bandGainsTo[i], rampEnd);
+        }
+
+        if (midSideActive)
+        {
+            sumBands(buffer, midSideStart, midSideEnd, false);
+            MidSideCodec::decode(buffer, numSamples);
+            sumBands(buffer, leftRightStart, leftRightEnd, true);
+        }
+        else
+        {
+            sumBands(buffer, leftRightStart, leftRightEnd, false);
+        }
+
+        if (dryIsAudible)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                buffer.addFromWithRamp(ch, 0, dryBuffer.getReadPointer(ch), numSamples,
+                    gainAt(dryGainFrom, dryGainTo, rampStart), gainAt(dryGainFrom, dryGainTo, rampEnd));
+        }
+    }
+
+    {
+        MBCOMP_PROFILE_STAGE(performanceMonitor, OutputGainStage);
+        applyGain(buffer, outputGain);
+    }
+}
+
+template struct MultibandEngine<float>;
+template struct MultibandEngine<double>;
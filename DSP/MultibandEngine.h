@@ -0,0 +1,173 @@
+/*
+  ==============================================================================
+
+    MultibandEngine.h
+    Created: 19 Oct 2026 11:02:15am
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "Constants.h"
+#include "CompressorBand.h"
+#include "LinearPhaseCrossover.h"
+#include "CrossoverKernel.h"
+#include "MidSideCodec.h"
+#include "Metering.h"
+#include "FIFO.h"
+#include "PerformanceMonitor.h"
+#include "TraceRecorder.h"
+
+/*
+    The audio path behind the analyzer taps: input gain, band split, the three
+    compressors, band summation and output gain.
+
+    Instantiated once for float and once for double (see MultibandEngine.cpp);
+    the processor prepares and runs only the one matching the host's precision.
+*/
+template<typename SampleType>
+struct MultibandEngine
+{
+    MultibandEngine();
+
+    void prepare(const juce::dsp::ProcessSpec& spec);
+    void process(juce::AudioBuffer<SampleType>& buffer);
+
+    /** Sorts the bus channels into front / surround / other link groups. Call before prepare. */
+    void setChannelLayout(const juce::AudioChannelSet& layout);
+
+    int getLatencySamples() const;
+
+    /** Off while rendering offline: the meters keep their periods but nothing is published. */
+    void setMeteringEnabled(bool shouldPublishMeters) { meteringEnabled = shouldPublishMeters; }
+
+    std::array<CompressorBand<SampleType>, 3> compressorArray;
+
+    CompressorBand<SampleType>& lowBandComp = compressorArray[0];
+    CompressorBand<SampleType>& midBandComp = compressorArray[1];
+    CompressorBand<SampleType>& highBandComp = compressorArray[2];
+
+    juce::AudioParameterFloat* lowMidCrossover{ nullptr };
+    juce::AudioParameterFloat* midHighCrossover{ nullptr };
+    juce::AudioParameterChoice* crossoverMode{ nullptr };
+    juce::AudioParameterChoice* linearPhasePartitionSize{ nullptr };
+
+    juce::AudioParameterFloat* inputGainParam{ nullptr };
+    juce::AudioParameterFloat* outputGainParam{ nullptr };
+    juce::AudioParameterFloat* mixParam{ nullptr };
+
+    std::array<juce::AudioParameterBool*, NumChannelGroups> linkGroupParams{};
+
+    // one MeterFrame per completed meter period is pushed here, frames are dropped if the reader falls behind
+    Fifo<MeterFrame, METER_FIFO_CAPACITY>* meterFifo{ nullptr };
+
+    // stage timings for the performance HUD, untouched unless the monitor is enabled
+    PerformanceMonitor* performanceMonitor{ nullptr };
+
+private:
+    CrossoverKernel<SampleType> crossover;
+
+    std::array<int, MAX_CHANNELS> channelGroups{};
+    std::array<int, MAX_CHANNELS> linkGroups{};
+    std::array<int, MAX_CHANNELS> unlinkedGroups{};
+    int numChannels{ 0 };
+
+    // effective per band routing for this block, LeftRight unless the bus is stereo
+    std::array<int, 3> bandStereoModes{};
+    bool midSideActive{ false };
+
+    LinearPhaseCrossover linearPhaseCrossover;
+    int lastCrossoverMode{ CrossoverMode::LinkwitzRiley };
+
+    // Both crossovers always run: the Linkwitz-Riley one because it is cheap, the linear phase one
+    // primed while unused. A mode switch crossfades their outputs, position counts samples towards
+    // linear phase and turns round wherever it is if the mode flips back mid fade.
+    int crossoverFadePosition{ 0 };
+    int crossoverFadeLength{ 1 };
+
+    // where the fade stood when the current sub-block was split, so the dry path follows the same ramp
+    int crossoverFadeStart{ 0 };
+    bool crossoverFading{ false };
+
+    /** linearPhase = linkwitzRiley + fade amount * (linearPhase - linkwitzRiley), over the current sub-block's ramp. */
+    void blendCrossoverFade(SampleType* linearPhase, const SampleType* linkwitzRiley, int numSamples) const;
+
+    std::array<juce::AudioBuffer<SampleType>, 3> filterBufferArray, transitionBufferArray;
+
+    juce::dsp::Gain<SampleType> inputGain, outputGain;
+
+    // dry signal for the global mix, delayed by the crossover latency; while the crossovers
+    // crossfade it is read at both latencies and faded the same way
+    juce::AudioBuffer<SampleType> dryDelayBuffer, dryBuffer, dryTransitionBuffer;
+    int dryWritePosition{ 0 };
+
+    // Host blocks are cut into ENGINE_SUB_BLOCK_SIZE periods aligned to the stream;
+    // this is how far into the current period the next sample falls.
+    int subBlockPosition{ 0 };
+    void processSubBlock(juce::AudioBuffer<SampleType>& buffer);
+
+    // summation gains for the current period, ramped from -> to across it
+    std::array<SampleType, 3> bandGainsFrom{}, bandGainsTo{};
+    SampleType dryGainFrom{ 0 }, dryGainTo{ 0 };
+
+    // Steps linearly to a new target over a fixed number of periods, restarting
+    // from wherever it is if the target moves again before it gets there.
+    struct GainFade
+    {
+        SampleType current{ 0 }, target{ 0 };
+        int remaining{ 0 };
+
+        void snap() { current = target; remaining = 0; }
+
+        SampleType advance(SampleType newTarget, int numPeriods)
+        {
+            if (newTarget != target)
+            {
+                target = newTarget;
+                remaining = numPeriods;
+            }
+
+            if (remaining > 0)
+                current += (target - current) / static_cast<SampleType>(remaining--);
+
+            return current;
+        }
+    };
+
+    // every summation gain fades over BAND_FADE_MS, the same time the compressors take to bypass
+    std::array<GainFade, 3> bandFades;
+    GainFade dryFade;
+    int fadePeriods{ 1 };
+
+    // Solo and mute resolved to a bit per band. The mask is folded into the band
+    // gains, so routing changes fade like any other gain; bands that have faded
+    // out are not compressed at all.
+    juce::uint32 audibleBands{ 0x7 };
+    juce::uint32 runningBands{ 0x7 };
+
+    /** buffer (= or +=) the sum of every band, each with its gain ramped from start to end. */
+    void sumBands(juce::AudioBuffer<SampleType>& buffer, const std::array<SampleType, 3>& startGains,
+        const std::array<SampleType, 3>& endGains, bool accumulate);
+
+    MeterFrame meterFrame;
+    bool meteringEnabled{ true };
+    void publishMeters();
+
+    void pushDrySignal(const juce::AudioBuffer<SampleType>& buffer);
+    void readDrySignal(int latency, int numSamples, juce::AudioBuffer<SampleType>& destination);
+
+    template<typename T, typename U>
+    void applyGain(T& buffer, U& gain)
+    {
+        auto block = juce::dsp::AudioBlock<SampleType>(buffer);
+        auto ctx = juce::dsp::ProcessContextReplacing<SampleType>(block);
+        gain.process(ctx);
+    }
+
+    void updateState();
+    void splitBands(const juce::AudioBuffer<SampleType>& inputBuffer);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MultibandEngine)
+};
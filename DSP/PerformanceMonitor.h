@@ -0,0 +1,139 @@
+/*
+  ==============================================================================
+
+    PerformanceMonitor.h
+    Created: 19 Oct 2026 6:20:44pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "Constants.h"
+
+enum ProfileStage
+{
+    InputTapStage,
+    InputGainStage,
+    SplitStage,
+    CompressLowStage,
+    CompressMidStage,
+    CompressHighStage,
+    SumStage,
+    OutputGainStage,
+    NumProfileStages
+};
+
+/*
+    Per stage audio thread timings, published through relaxed atomics so the
+    editor can read them at any time without locking. Each block's stage times
+    are accumulated on the audio thread and folded into a smoothed average when
+    the block ends. The message thread side (analyzer and paint times) is only
+    ever touched from the message thread.
+*/
+struct PerformanceMonitor
+{
+    PerformanceMonitor() = default;
+
+    void setEnabled(bool shouldBeEnabled) { enabled.store(shouldBeEnabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    //==============================================================================
+    // audio thread
+    void beginBlock(int numSamples, double sampleRate)
+    {
+        blockStartTicks = juce::Time::getHighResolutionTicks();
+        blockDurationSeconds = sampleRate > 0.0 ? numSamples / sampleRate : 0.0;
+        stageTicks.fill(0);
+    }
+
+    void endBlock()
+    {
+        const auto ticksPerSecond = static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+        const double blockSeconds = (juce::Time::getHighResolutionTicks() - blockStartTicks) / ticksPerSecond;
+
+        if (blockDurationSeconds > 0.0)
+        {
+            const float load = static_cast<float>(blockSeconds / blockDurationSeconds);
+            smoothedLoad = smooth(smoothedLoad, load);
+            dspLoad.store(smoothedLoad, std::memory_order_relaxed);
+
+            if (load > peakLoad.load(std::memory_order_relaxed))
+                peakLoad.store(load, std::memory_order_relaxed);
+        }
+
+        for (int stage = 0; stage < NumProfileStages; ++stage)
+        {
+            const float micros = static_cast<float>(stageTicks[stage] * 1.0e6 / ticksPerSecond);
+            smoothedStageMicros[stage] = smooth(smoothedStageMicros[stage], micros);
+            stageMicros[stage].store(smoothedStageMicros[stage], std::memory_order_relaxed);
+        }
+    }
+
+    void addStageTicks(ProfileStage stage, juce::int64 ticks) { stageTicks[stage] += ticks; }
+
+    struct ScopedStage
+    {
+        ScopedStage(PerformanceMonitor* m, ProfileStage s) :
+            monitor(m != nullptr && m->isEnabled() ? m : nullptr),
+            stage(s),
+            startTicks(monitor != nullptr ? juce::Time::getHighResolutionTicks() : 0)
+        {
+        }
+
+        ~ScopedStage()
+        {
+            if (monitor != nullptr)
+                monitor->addStageTicks(stage, juce::Time::getHighResolutionTicks() - startTicks);
+        }
+
+        PerformanceMonitor* monitor;
+        ProfileStage stage;
+        juce::int64 startTicks;
+    };
+
+    //==============================================================================
+    // any thread
+    float getDspLoad() const { return dspLoad.load(std::memory_order_relaxed); }
+    float getStageMicros(int stage) const { return stageMicros[stage].load(std::memory_order_relaxed); }
+
+    /** Highest single block load since the last call. */
+    float takePeakLoad() { return peakLoad.exchange(0.0f, std::memory_order_relaxed); }
+
+    //==============================================================================
+    // message thread
+    float analyzerMicros{ 0.0f };
+    float paintMicros{ 0.0f };
+
+    void addMessageThreadTime(float& target, juce::int64 startTicks) const
+    {
+        const auto ticks = juce::Time::getHighResolutionTicks() - startTicks;
+        target = smooth(target, static_cast<float>(ticks * 1.0e6 / juce::Time::getHighResolutionTicksPerSecond()));
+    }
+
+private:
+    static float smooth(float previous, float latest) { return previous + 0.1f * (latest - previous); }
+
+    std::atomic<bool> enabled{ false };
+
+    juce::int64 blockStartTicks{ 0 };
+    double blockDurationSeconds{ 0.0 };
+    std::array<juce::int64, NumProfileStages> stageTicks{};
+    std::array<float, NumProfileStages> smoothedStageMicros{};
+    float smoothedLoad{ 0.0f };
+
+    std::atomic<float> dspLoad{ 0.0f };
+    std::atomic<float> peakLoad{ 0.0f };
+    std::array<std::atomic<float>, NumProfileStages> stageMicros{};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PerformanceMonitor)
+};
+
+#if MBCOMP_PROFILING
+#define MBCOMP_PROFILE_STAGE(monitor, stage) PerformanceMonitor::ScopedStage JUCE_JOIN_MACRO(profileStage_, __LINE__)(monitor, stage)
+#else
+#define MBCOMP_PROFILE_STAGE(monitor, stage)
+#endif
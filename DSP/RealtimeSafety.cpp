@@ -0,0 +1,284 @@
+/*
+  ==============================================================================
+
+    RealtimeSafety.cpp
+    Created: 19 Oct 2026 8:52:07pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "RealtimeSafety.h"
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace RealtimeSafety
+{
+    namespace
+    {
+        constexpr int maxStoredReports = 64;
+
+        thread_local int realtimeDepth = 0;
+        thread_local bool isReporting = false;
+        thread_local int threadViolations = 0;
+
+        std::atomic<int> numViolations{ 0 };
+
+        struct ReportStore
+        {
+            std::mutex mutex;
+            juce::StringArray reports;
+        };
+
+        ReportStore& getReportStore()
+        {
+            static ReportStore store;
+            return store;
+        }
+    }
+
+    ScopedRealtimeSection::ScopedRealtimeSection() { ++realtimeDepth; }
+    ScopedRealtimeSection::~ScopedRealtimeSection() { --realtimeDepth; }
+
+    bool isInRealtimeSection() noexcept
+    {
+        return realtimeDepth > 0 && !isReporting;
+    }
+
+    void reportViolation(const char* what) noexcept
+    {
+        if (isReporting)
+            return;
+
+        // everything below allocates, which must not report itself again
+        isReporting = true;
+
+        ++threadViolations;
+        numViolations.fetch_add(1, std::memory_order_relaxed);
+
+        try
+        {
+            const auto report = juce::String(what) + " inside processBlock\n" + juce::SystemStats::getStackBacktrace();
+            DBG(report);
+
+            auto& store = getReportStore();
+            const std::lock_guard<std::mutex> lock(store.mutex);
+            if (store.reports.size() < maxStoredReports)
+                store.reports.add(report);
+        }
+        catch (...) {}
+
+        isReporting = false;
+    }
+
+    int getNumViolations() noexcept { return numViolations.load(std::memory_order_relaxed); }
+
+    int getNumViolationsOnThisThread() noexcept { return threadViolations; }
+
+    juce::StringArray takeReports()
+    {
+        auto& store = getReportStore();
+        const std::lock_guard<std::mutex> lock(store.mutex);
+
+        juce::StringArray reports;
+        reports.swapWith(store.reports);
+        return reports;
+    }
+}
+
+#if MBCOMP_REALTIME_CHECKS
+
+#if defined(__GLIBC__)
+#include <dlfcn.h>
+#include <pthread.h>
+
+// glibc's own allocator entry points, so the replacements below can forward without calling themselves
+extern "C" void* __libc_malloc(std::size_t) noexcept;
+extern "C" void* __libc_calloc(std::size_t, std::size_t) noexcept;
+extern "C" void* __libc_realloc(void*, std::size_t) noexcept;
+extern "C" void __libc_free(void*) noexcept;
+
+#define MBCOMP_INTERPOSE_LIBC 1
+#else
+#define MBCOMP_INTERPOSE_LIBC 0
+#endif
+
+//==============================================================================
+// Replacements for the global allocation functions. The aligned overloads keep
+// their default implementation; nothing in the audio path over-aligns.
+
+namespace
+{
+    void* rawAllocate(std::size_t size) noexcept
+    {
+#if MBCOMP_INTERPOSE_LIBC
+        return __libc_malloc(size);
+#else
+        return std::malloc(size);
+#endif
+    }
+
+    void rawFree(void* ptr) noexcept
+    {
+#if MBCOMP_INTERPOSE_LIBC
+        __libc_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    void* checkedAllocate(std::size_t size) noexcept
+    {
+        if (RealtimeSafety::isInRealtimeSection())
+            RealtimeSafety::reportViolation("allocation");
+
+        return rawAllocate(size == 0 ? 1 : size);
+    }
+
+    void checkedFree(void* ptr) noexcept
+    {
+        if (ptr != nullptr && RealtimeSafety::isInRealtimeSection())
+            RealtimeSafety::reportViolation("deallocation");
+
+        rawFree(ptr);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    if (auto* ptr = checkedAllocate(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    if (auto* ptr = checkedAllocate(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return checkedAllocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return checkedAllocate(size); }
+
+void operator delete(void* ptr) noexcept { checkedFree(ptr); }
+void operator delete[](void* ptr) noexcept { checkedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { checkedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { checkedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { checkedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { checkedFree(ptr); }
+
+#if MBCOMP_INTERPOSE_LIBC
+
+//==============================================================================
+// The C allocator and the mutex lock. Protected visibility binds every call made
+// from code compiled into the plugin (JUCE included) to these, even when the
+// plugin is dlopen'ed by a host whose own symbols come first; the host and the
+// system libraries keep glibc's. The system headers have already declared these
+// with default visibility, so it is set on the symbols directly.
+
+__asm__(".protected malloc\n"
+        ".protected calloc\n"
+        ".protected realloc\n"
+        ".protected free\n"
+        ".protected pthread_mutex_lock");
+
+#define MBCOMP_INTERPOSED extern "C"
+
+MBCOMP_INTERPOSED void* malloc(std::size_t size) noexcept
+{
+    if (RealtimeSafety::isInRealtimeSection())
+        RealtimeSafety::reportViolation("malloc");
+
+    return __libc_malloc(size);
+}
+
+MBCOMP_INTERPOSED void* calloc(std::size_t count, std::size_t size) noexcept
+{
+    if (RealtimeSafety::isInRealtimeSection())
+        RealtimeSafety::reportViolation("calloc");
+
+    return __libc_calloc(count, size);
+}
+
+MBCOMP_INTERPOSED void* realloc(void* ptr, std::size_t size) noexcept
+{
+    if (RealtimeSafety::isInRealtimeSection())
+        RealtimeSafety::reportViolation("realloc");
+
+    return __libc_realloc(ptr, size);
+}
+
+MBCOMP_INTERPOSED void free(void* ptr) noexcept
+{
+    if (ptr != nullptr && RealtimeSafety::isInRealtimeSection())
+        RealtimeSafety::reportViolation("free");
+
+    __libc_free(ptr);
+}
+
+namespace
+{
+    using MutexLockFunction = int (*)(pthread_mutex_t*);
+
+    // looked up on first use; no function local static, its guard may lock a mutex itself
+    std::atomic<MutexLockFunction> systemMutexLock{ nullptr };
+}
+
+MBCOMP_INTERPOSED int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+{
+    if (RealtimeSafety::isInRealtimeSection())
+        RealtimeSafety::reportViolation("lock");
+
+    auto lock = systemMutexLock.load(std::memory_order_relaxed);
+    if (lock == nullptr)
+    {
+        lock = reinterpret_cast<MutexLockFunction>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+        systemMutexLock.store(lock, std::memory_order_relaxed);
+    }
+
+    return lock(mutex);
+}
+
+#undef MBCOMP_INTERPOSED
+
+#endif
+
+//==============================================================================
+juce::StringArray RealtimeSafety::runSelfCheck()
+{
+    juce::StringArray missed;
+
+    auto expectViolation = [&missed](const char* what, auto&& forbidden)
+        {
+            const int before = getNumViolationsOnThisThread();
+            {
+                ScopedRealtimeSection section;
+                forbidden();
+            }
+
+            if (getNumViolationsOnThisThread() == before)
+                missed.add(what);
+        };
+
+    juce::AudioBuffer<float> buffer(2, 64);
+    expectViolation("operator new", []
+        {
+            // volatile, so the pair cannot be optimised away
+            int* volatile allocated = new int(0);
+            delete allocated;
+        });
+    expectViolation("AudioBuffer::setSize", [&buffer] { buffer.setSize(2, 8192); });
+
+#if MBCOMP_INTERPOSE_LIBC
+    juce::CriticalSection lock;
+    expectViolation("CriticalSection::enter", [&lock] { const juce::ScopedLock sl(lock); });
+#endif
+
+    takeReports();
+    return missed;
+}
+
+#endif
@@ -0,0 +1,61 @@
+/*
+  ==============================================================================
+
+    RealtimeSafety.h
+    Created: 19 Oct 2026 8:52:07pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "Constants.h"
+
+/*
+    Debug checker for work the audio thread must never do. processBlock marks
+    itself as a realtime section; while a thread is inside one, every global
+    operator new / delete is reported with the call stack that led to it.
+
+    On glibc the checked build also interposes malloc, calloc, realloc, free
+    and pthread_mutex_lock for code compiled into the plugin, which covers
+    juce::HeapBlock (and so AudioBuffer::setSize), juce::CriticalSection and
+    std::mutex. Elsewhere only operator new / delete are seen. Reporting is
+    allowed to allocate: by the time it runs the block has already done
+    something it should not have.
+*/
+namespace RealtimeSafety
+{
+    struct ScopedRealtimeSection
+    {
+        ScopedRealtimeSection();
+        ~ScopedRealtimeSection();
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedRealtimeSection)
+    };
+
+    bool isInRealtimeSection() noexcept;
+
+    /** Called by the allocation and lock replacements. */
+    void reportViolation(const char* what) noexcept;
+
+    int getNumViolations() noexcept;
+
+    /** Violations on the calling thread only, for renders that drive processBlock themselves. */
+    int getNumViolationsOnThisThread() noexcept;
+
+    /** Removes and returns the stored reports, each with its call stack. */
+    juce::StringArray takeReports();
+
+#if MBCOMP_REALTIME_CHECKS
+    /** Does forbidden things inside a realtime section of its own and checks each one is caught.
+        Returns what went unreported, empty when the checker works. Discards the stored reports. */
+    juce::StringArray runSelfCheck();
+#endif
+}
+
+#if MBCOMP_REALTIME_CHECKS
+#define MBCOMP_REALTIME_SECTION() RealtimeSafety::ScopedRealtimeSection JUCE_JOIN_MACRO(realtimeSection_, __LINE__)
+#else
+#define MBCOMP_REALTIME_SECTION()
+#endif
@@ -0,0 +1,66 @@
+/*
+  ==============================================================================
+
+    RenderThroughput.h
+    Created: 19 Oct 2026 9:12:37pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+
+/*
+    Offline render counter: samples rendered and the wall clock time spent in
+    processBlock while the host renders non-realtime. The audio thread adds to
+    it once per block, any thread can read it. It is cleared every time the
+    host switches into offline rendering, so it always describes the current
+    (or last) bounce.
+*/
+struct RenderThroughput
+{
+    RenderThroughput() = default;
+
+    void reset()
+    {
+        samplesRendered.store(0, std::memory_order_relaxed);
+        ticksSpent.store(0, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    // audio thread
+    void beginBlock() { blockStartTicks = juce::Time::getHighResolutionTicks(); }
+
+    void endBlock(int numSamples)
+    {
+        ticksSpent.fetch_add(juce::Time::getHighResolutionTicks() - blockStartTicks, std::memory_order_relaxed);
+        samplesRendered.fetch_add(numSamples, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    // any thread
+    juce::int64 getSamplesRendered() const { return samplesRendered.load(std::memory_order_relaxed); }
+
+    double getSecondsSpent() const
+    {
+        return static_cast<double>(ticksSpent.load(std::memory_order_relaxed))
+            / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+    }
+
+    /** Seconds of audio rendered per second spent in processBlock, 0 until something has been rendered. */
+    double getSpeed(double sampleRate) const
+    {
+        const auto seconds = getSecondsSpent();
+        return seconds > 0.0 && sampleRate > 0.0 ? getSamplesRendered() / sampleRate / seconds : 0.0;
+    }
+
+private:
+    juce::int64 blockStartTicks{ 0 };
+
+    std::atomic<juce::int64> samplesRendered{ 0 };
+    std::atomic<juce::int64> ticksSpent{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderThroughput)
+};
@@ -25,9 +25,11 @@ struct SingleChannelSampleFifo
     bool isPrepared() const noexcept;
     int  getSize() const noexcept;
     int  getNumCompleteBuffersAvailable() const noexcept;
+    int  getNumDroppedBuffers() const noexcept { return audioBufferFifo.getNumDropped(); }
 
     // operation
-    void update(const BlockType& buffer);
+    template<typename SampleType>
+    void update(const juce::AudioBuffer<SampleType>& buffer);
     bool getAudioBuffer(BlockType& buf);
 
 private:
@@ -78,14 +80,19 @@ int SingleChannelSampleFifo<BlockType>::getNumCompleteBuffersAvailable() const n
 }
 
 template<typename BlockType>
-void SingleChannelSampleFifo<BlockType>::update(const BlockType& buffer)
+template<typename SampleType>
+void SingleChannelSampleFifo<BlockType>::update(const juce::AudioBuffer<SampleType>& buffer)
 {
     jassert(prepared.get());
-    jassert(buffer.getNumChannels() > channelToUse);
+    jassert(buffer.getNumChannels() > 0);
 
-    const float* channelPtr = buffer.getReadPointer(channelToUse);
+    // a mono bus feeds both analyzer taps from its only channel
+    const int channel = juce::jmin(static_cast<int>(channelToUse), buffer.getNumChannels() - 1);
+
+    // the analyzer always works in float, a double precision host is narrowed here
+    const SampleType* channelPtr = buffer.getReadPointer(channel);
     for (int i = 0; i < buffer.getNumSamples(); ++i)
-        pushNextSampleIntoFifo(channelPtr[i]);
+        pushNextSampleIntoFifo(static_cast<float>(channelPtr[i]));
 }
 
 template<typename BlockType>
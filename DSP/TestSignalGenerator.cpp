@@ -0,0 +1,165 @@
+/*
+  ==============================================================================
+
+    TestSignalGenerator.cpp
+    Created: 19 Oct 2026 11:34:50pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "TestSignalGenerator.h"
+
+namespace
+{
+    constexpr double sineFrequency = 1000.0;
+    constexpr double sweepStartFrequency = MIN_FREQUENCY;
+    constexpr double sweepEndFrequency = MAX_FREQUENCY;
+    constexpr double sweepSeconds = 10.0;
+    constexpr double impulseSeconds = 0.5;
+}
+
+const std::array<float, TestSignalGenerator::tableSize + 1>& TestSignalGenerator::getSineTable()
+{
+    // one extra point so the interpolation never wraps
+    static const auto table = []
+        {
+            std::array<float, tableSize + 1> t;
+            for (int i = 0; i <= tableSize; ++i)
+                t[static_cast<size_t>(i)] = static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * i / tableSize));
+            return t;
+        }();
+
+    return table;
+}
+
+void TestSignalGenerator::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+
+    sineIncrement = sineFrequency / sampleRate;
+
+    sweepLength = juce::roundToInt(sweepSeconds * sampleRate);
+    sweepStartIncrement = sweepStartFrequency / sampleRate;
+    sweepFactor = std::pow(sweepEndFrequency / sweepStartFrequency, 1.0 / sweepLength);
+
+    impulseInterval = juce::roundToInt(impulseSeconds * sampleRate);
+
+    // builds the table here rather than on the audio thread
+    getSineTable();
+
+    reset();
+}
+
+void TestSignalGenerator::reset()
+{
+    phase = 0.0;
+    sweepIncrement = sweepStartIncrement;
+    sweepPosition = 0;
+    noiseState = 0x5eed1234;
+    pinkState.fill(0.0f);
+    impulseCountdown = 0;
+}
+
+float TestSignalGenerator::nextSine(double increment)
+{
+    const auto& table = getSineTable();
+
+    const double position = phase * tableSize;
+    const int index = static_cast<int>(position);
+    const float fraction = static_cast<float>(position - index);
+
+    phase += increment;
+    if (phase >= 1.0)
+        phase -= 1.0;
+
+    const float a = table[static_cast<size_t>(index)];
+    const float b = table[static_cast<size_t>(index) + 1];
+    return a + fraction * (b - a);
+}
+
+float TestSignalGenerator::nextPinkNoise()
+{
+    noiseState ^= noiseState << 13;
+    noiseState ^= noiseState >> 17;
+    noiseState ^= noiseState << 5;
+    const float white = static_cast<float>(static_cast<juce::int32>(noiseState)) * (1.0f / 2147483648.0f);
+
+    // Paul Kellet's refined pink filter, about -3 dB per octave down to 10 Hz
+    auto& b = pinkState;
+    b[0] = 0.99886f * b[0] + white * 0.0555179f;
+    b[1] = 0.99332f * b[1] + white * 0.0750759f;
+    b[2] = 0.96900f * b[2] + white * 0.1538520f;
+    b[3] = 0.86650f * b[3] + white * 0.3104856f;
+    b[4] = 0.55000f * b[4] + white * 0.5329522f;
+    b[5] = -0.7616f * b[5] - white * 0.0168980f;
+    const float pink = b[0] + b[1] + b[2] + b[3] + b[4] + b[5] + b[6] + white * 0.5362f;
+    b[6] = white * 0.115926f;
+
+    return pink * 0.11f;
+}
+
+template<typename SampleType>
+void TestSignalGenerator::process(juce::AudioBuffer<SampleType>& buffer)
+{
+    const auto signal = getSignal();
+    if (signal != currentSignal)
+    {
+        currentSignal = signal;
+        reset();
+    }
+
+    const int numSamples = buffer.getNumSamples();
+    auto* output = buffer.getWritePointer(0);
+
+    switch (currentSignal)
+    {
+    case SineSignal:
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = static_cast<SampleType>(level * nextSine(sineIncrement));
+        break;
+
+    case LogSweepSignal:
+        for (int i = 0; i < numSamples; ++i)
+        {
+            output[i] = static_cast<SampleType>(level * nextSine(sweepIncrement));
+            sweepIncrement *= sweepFactor;
+
+            if (++sweepPosition == sweepLength)
+            {
+                sweepPosition = 0;
+                sweepIncrement = sweepStartIncrement;
+                phase = 0.0;
+            }
+        }
+        break;
+
+    case PinkNoiseSignal:
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = static_cast<SampleType>(level * nextPinkNoise());
+        break;
+
+    case ImpulseSignal:
+        // unit impulses, for impulse response captures
+        juce::FloatVectorOperations::clear(output, numSamples);
+        for (int i = 0; i < numSamples; ++i)
+        {
+            if (impulseCountdown-- == 0)
+            {
+                output[i] = SampleType(1);
+                impulseCountdown = impulseInterval - 1;
+            }
+        }
+        break;
+
+    case TestSignalOff:
+        return;
+    }
+
+    // every channel gets the same signal
+    for (int channel = 1; channel < buffer.getNumChannels(); ++channel)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
+}
+
+template void TestSignalGenerator::process<float>(juce::AudioBuffer<float>&);
+template void TestSignalGenerator::process<double>(juce::AudioBuffer<double>&);
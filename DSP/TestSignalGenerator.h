@@ -0,0 +1,71 @@
+/*
+  ==============================================================================
+
+    TestSignalGenerator.h
+    Created: 19 Oct 2026 11:34:50pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "Constants.h"
+
+/*
+    Reproducible test signals for profiling and calibration. When a signal is
+    selected it replaces the processor's input ahead of the analyzer tap and
+    the engine, so both see exactly the same material on every run. The sine
+    and sweep read a shared interpolated table and the noise comes from a
+    seeded xorshift generator, so nothing allocates and nothing calls into
+    libm per sample. While off, the only cost is one relaxed load per block.
+*/
+struct TestSignalGenerator
+{
+    TestSignalGenerator() = default;
+
+    /** Any thread. */
+    void setSignal(TestSignal signal) { selectedSignal.store(signal, std::memory_order_relaxed); }
+    TestSignal getSignal() const { return static_cast<TestSignal>(selectedSignal.load(std::memory_order_relaxed)); }
+    bool isActive() const { return getSignal() != TestSignalOff; }
+
+    void prepare(double sampleRate);
+
+    /** Audio thread: overwrites every channel with the selected signal. */
+    template<typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& buffer);
+
+private:
+    static constexpr int tableSize = 4096;
+    static const std::array<float, tableSize + 1>& getSineTable();
+
+    std::atomic<int> selectedSignal{ TestSignalOff };
+    TestSignal currentSignal{ TestSignalOff };
+
+    double sampleRate{ 44100.0 };
+    float level{ 0.25f }; // -12 dBFS
+
+    // phase in cycles, [0, 1)
+    double phase{ 0.0 };
+    double sineIncrement{ 0.0 };
+
+    double sweepIncrement{ 0.0 };
+    double sweepStartIncrement{ 0.0 };
+    double sweepFactor{ 1.0 };
+    int sweepLength{ 0 };
+    int sweepPosition{ 0 };
+
+    juce::uint32 noiseState{ 0x5eed1234 };
+    std::array<float, 7> pinkState{};
+
+    int impulseInterval{ 0 };
+    int impulseCountdown{ 0 };
+
+    void reset();
+    float nextSine(double increment);
+    float nextPinkNoise();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TestSignalGenerator)
+};
@@ -0,0 +1,153 @@
+/*
+  ==============================================================================
+
+    TraceRecorder.cpp
+    Created: 19 Oct 2026 7:02:51pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "TraceRecorder.h"
+
+namespace
+{
+    // which buffer this thread writes to, and for which capture it was claimed
+    struct ThreadClaim
+    {
+        void* buffer{ nullptr };
+        int captureId{ -1 };
+    };
+
+    thread_local ThreadClaim threadClaim;
+}
+
+TraceRecorder& TraceRecorder::getInstance()
+{
+    static TraceRecorder instance;
+    return instance;
+}
+
+void TraceRecorder::startRecording()
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    jassert(!isRecording());
+
+    for (auto& buffer : buffers)
+    {
+        if (buffer == nullptr)
+            buffer = std::make_unique<ThreadBuffer>();
+
+        buffer->numWritten.store(0, std::memory_order_relaxed);
+        buffer->threadName = {};
+        buffer->isMessageThread = false;
+    }
+
+    numClaimedBuffers.store(0, std::memory_order_relaxed);
+    captureStartTicks = juce::Time::getHighResolutionTicks();
+
+    // invalidates every thread's claim from the previous capture
+    captureId.fetch_add(1, std::memory_order_relaxed);
+    recording.store(true, std::memory_order_release);
+}
+
+void TraceRecorder::stopRecording()
+{
+    recording.store(false, std::memory_order_release);
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::getBufferForThisThread()
+{
+    const int currentCapture = captureId.load(std::memory_order_acquire);
+
+    if (threadClaim.captureId == currentCapture)
+        return static_cast<ThreadBuffer*>(threadClaim.buffer);
+
+    const int index = numClaimedBuffers.fetch_add(1, std::memory_order_relaxed);
+    if (index >= TRACE_MAX_THREADS)
+        return nullptr;
+
+    auto* buffer = buffers[index].get();
+
+    // copying a juce::String only bumps a reference count, this does not allocate
+    if (auto* thread = juce::Thread::getCurrentThread())
+        buffer->threadName = thread->getThreadName();
+
+    buffer->isMessageThread = juce::MessageManager::existsAndIsCurrentThread();
+
+    threadClaim.buffer = buffer;
+    threadClaim.captureId = currentCapture;
+    return buffer;
+}
+
+void TraceRecorder::addEvent(const char* name, juce::int64 startTicks, juce::int64 endTicks)
+{
+    if (!recording.load(std::memory_order_acquire))
+        return;
+
+    auto* buffer = getBufferForThisThread();
+    if (buffer == nullptr)
+        return;
+
+    const int n = buffer->numWritten.load(std::memory_order_relaxed);
+    buffer->events[n % TRACE_EVENTS_PER_THREAD] = { name, startTicks, endTicks };
+    buffer->numWritten.store(n + 1, std::memory_order_release);
+}
+
+bool TraceRecorder::writeChromeTrace(const juce::File& file) const
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    jassert(!isRecording());
+
+    juce::FileOutputStream stream(file);
+    if (!stream.openedOk())
+        return false;
+
+    stream.setPosition(0);
+    stream.truncate();
+
+    const double microsPerTick = 1.0e6 / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+    const int numBuffers = juce::jmin(numClaimedBuffers.load(std::memory_order_acquire), TRACE_MAX_THREADS);
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    auto separator = [&first]() -> const char*
+        {
+            const char* s = first ? "\n" : ",\n";
+            first = false;
+            return s;
+        };
+
+    for (int i = 0; i < numBuffers; ++i)
+    {
+        const auto& buffer = *buffers[i];
+        const int tid = i + 1;
+
+        auto threadName = buffer.threadName;
+        if (threadName.isEmpty())
+            threadName = buffer.isMessageThread ? "Message thread" : "Host thread " + juce::String(tid);
+
+        stream << separator()
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+            << ",\"args\":{\"name\":" << juce::JSON::toString(threadName) << "}}";
+
+        const int numWritten = buffer.numWritten.load(std::memory_order_acquire);
+        const int numEvents = juce::jmin(numWritten, TRACE_EVENTS_PER_THREAD);
+
+        for (int e = numWritten - numEvents; e < numWritten; ++e)
+        {
+            const auto& event = buffer.events[e % TRACE_EVENTS_PER_THREAD];
+
+            stream << separator()
+                << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                << ",\"ts\":" << juce::String((event.startTicks - captureStartTicks) * microsPerTick, 3)
+                << ",\"dur\":" << juce::String((event.endTicks - event.startTicks) * microsPerTick, 3) << "}";
+        }
+    }
+
+    stream << "\n]}\n";
+    stream.flush();
+
+    return stream.getStatus().wasOk();
+}
@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    TraceRecorder.h
+    Created: 19 Oct 2026 7:02:51pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include "Constants.h"
+
+#define TRACE_MAX_THREADS 16
+#define TRACE_EVENTS_PER_THREAD 16384
+
+/*
+    Process wide recorder for scoped trace events, written out as Chrome trace
+    event JSON (chrome://tracing, ui.perfetto.dev).
+
+    Every thread that records claims one of a fixed set of buffers on its first
+    event and from then on is the only writer to it, so recording is one clock
+    read at each end of the scope plus a store; no locks and no allocation. The
+    buffers are allocated when recording is first started from the message
+    thread. Each buffer is a ring, so a long capture keeps the most recent
+    events of every thread.
+
+    Event names must be string literals, only the pointer is stored.
+*/
+struct TraceRecorder
+{
+    static TraceRecorder& getInstance();
+
+    /** Message thread: starting a capture drops whatever the buffers held. */
+    void startRecording();
+    void stopRecording();
+    bool isRecording() const { return recording.load(std::memory_order_relaxed); }
+
+    /** Message thread, after stopRecording(). */
+    bool writeChromeTrace(const juce::File& file) const;
+
+    void addEvent(const char* name, juce::int64 startTicks, juce::int64 endTicks);
+
+    struct ScopedTrace
+    {
+        explicit ScopedTrace(const char* eventName) :
+            name(TraceRecorder::getInstance().isRecording() ? eventName : nullptr),
+            startTicks(name != nullptr ? juce::Time::getHighResolutionTicks() : 0)
+        {
+        }
+
+        ~ScopedTrace()
+        {
+            if (name != nullptr)
+                TraceRecorder::getInstance().addEvent(name, startTicks, juce::Time::getHighResolutionTicks());
+        }
+
+        const char* name;
+        juce::int64 startTicks;
+    };
+
+private:
+    TraceRecorder() = default;
+
+    struct Event
+    {
+        const char* name;
+        juce::int64 startTicks;
+        juce::int64 endTicks;
+    };
+
+    struct ThreadBuffer
+    {
+        std::array<Event, TRACE_EVENTS_PER_THREAD> events;
+        std::atomic<int> numWritten{ 0 };
+        juce::String threadName;
+        bool isMessageThread{ false };
+    };
+
+    ThreadBuffer* getBufferForThisThread();
+
+    std::array<std::unique_ptr<ThreadBuffer>, TRACE_MAX_THREADS> buffers;
+    std::atomic<int> numClaimedBuffers{ 0 };
+    std::atomic<int> captureId{ 0 };
+    std::atomic<bool> recording{ false };
+    juce::int64 captureStartTicks{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TraceRecorder)
+};
+
+#if MBCOMP_PROFILING
+#define MBCOMP_TRACE_SCOPE(name) TraceRecorder::ScopedTrace JUCE_JOIN_MACRO(traceScope_, __LINE__)(name)
+#else
+#define MBCOMP_TRACE_SCOPE(name)
+#endif
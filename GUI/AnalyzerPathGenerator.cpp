@@ -16,6 +16,8 @@ void AnalyzerPathGenerator::generatePath(const std::vector<float>& renderData,
     float binWidth,
     float negativeInfinity)
 {
+    MBCOMP_TRACE_SCOPE("AnalyzerPathGenerator::generatePath");
+
     const float top = fftBounds.getY();
     const float bottom = fftBounds.getBottom();
     const float width = fftBounds.getWidth();
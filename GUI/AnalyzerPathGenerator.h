@@ -12,6 +12,7 @@
 
 #include <JuceHeader.h>
 #include "../DSP/FIFO.h"
+#include "../DSP/TraceRecorder.h"
 
 class AnalyzerPathGenerator
 {
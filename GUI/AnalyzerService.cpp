@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    AnalyzerService.cpp
+    Created: 19 Oct 2026 10:58:13pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "AnalyzerService.h"
+
+struct AnalyzerService::Job : juce::ThreadPoolJob
+{
+    Job(AnalyzerService& s, Client& c) : juce::ThreadPoolJob("Analyzer"), service(s), client(c) {}
+
+    JobStatus runJob() override
+    {
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+
+        client.runAnalysis();
+
+        const auto micros = static_cast<float>((juce::Time::getHighResolutionTicks() - startTicks) * 1.0e6
+            / juce::Time::getHighResolutionTicksPerSecond());
+
+        // only jobs write it, and this is advisory, so a lost update between two workers does not matter
+        const float previous = service.averageJobMicros.load(std::memory_order_relaxed);
+        service.averageJobMicros.store(previous + 0.1f * (micros - previous), std::memory_order_relaxed);
+
+        return jobHasFinished;
+    }
+
+    AnalyzerService& service;
+    Client& client;
+};
+
+AnalyzerService::AnalyzerService()
+    : pool(juce::jlimit(1, ANALYZER_MAX_WORKERS, juce::SystemStats::getNumCpus() - 1))
+{
+}
+
+AnalyzerService::~AnalyzerService()
+{
+    stopTimer();
+
+    // every analyzer removes itself before it goes away
+    jassert(jobs.empty());
+    pool.removeAllJobs(false, 1000);
+}
+
+void AnalyzerService::addClient(Client& client)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    jobs.push_back(std::make_unique<Job>(*this, client));
+
+    if (!isTimerRunning())
+        startTimerHz(60);
+}
+
+void AnalyzerService::removeClient(Client& client)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    auto found = std::find_if(jobs.begin(), jobs.end(), [&client](const auto& job) { return &job->client == &client; });
+    if (found == jobs.end())
+        return;
+
+    // a queued job is dropped, a running one is waited for
+    pool.removeJob(found->get(), false, -1);
+    jobs.erase(found);
+
+    if (jobs.empty())
+        stopTimer();
+}
+
+void AnalyzerService::timerCallback()
+{
+    if (jobs.empty())
+        return;
+
+    // until a job has been timed assume it fits, after that hand out as many as the budget covers
+    const float jobMicros = getAverageJobMicros();
+    const int maxJobs = jobMicros > 0.0f
+        ? juce::jmax(1, static_cast<int>(ANALYZER_FRAME_BUDGET_MS * 1000.0 / jobMicros))
+        : static_cast<int>(jobs.size());
+
+    int numQueued = 0;
+
+    // start where the last frame stopped so nobody is starved
+    for (size_t i = 0; i < jobs.size() && numQueued < maxJobs; ++i)
+    {
+        auto& job = *jobs[(nextJob + i) % jobs.size()];
+
+        if (pool.contains(&job) || !job.client.wantsAnalysis())
+            continue;
+
+        job.client.prepareAnalysis();
+        pool.addJob(&job, false);
+        ++numQueued;
+
+        nextJob = (nextJob + i + 1) % jobs.size();
+    }
+}
@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    AnalyzerService.h
+    Created: 19 Oct 2026 10:58:13pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "../DSP/Constants.h"
+
+/*
+    One per process, held through a juce::SharedResourcePointer. Analyzers
+    register while they have analysis switched on; every frame the service
+    queues FFT and path work for the ones actually showing onto a small
+    worker pool, round robin and within a shared time budget. With more
+    visible editors than the budget covers each one is simply analysed less
+    often, so analysis cost follows the editors on screen, not the number of
+    instances in the session.
+*/
+struct AnalyzerService : private juce::Timer
+{
+    struct Client
+    {
+        virtual ~Client() = default;
+
+        /** Message thread: false while the client is hidden, it is skipped without losing its slot. */
+        virtual bool wantsAnalysis() = 0;
+
+        /** Message thread, just before the job is queued: capture whatever the job reads. */
+        virtual void prepareAnalysis() = 0;
+
+        /** Worker thread, never more than one at a time per client. */
+        virtual void runAnalysis() = 0;
+    };
+
+    AnalyzerService();
+    ~AnalyzerService() override;
+
+    /** Message thread. */
+    void addClient(Client& client);
+
+    /** Message thread. Waits for the client's job if one is running. */
+    void removeClient(Client& client);
+
+    /** Smoothed worker time of one client's frame. */
+    float getAverageJobMicros() const { return averageJobMicros.load(std::memory_order_relaxed); }
+
+private:
+    struct Job;
+
+    juce::ThreadPool pool;
+    std::vector<std::unique_ptr<Job>> jobs;
+    size_t nextJob{ 0 };
+
+    std::atomic<float> averageJobMicros{ 0.0f };
+
+    void timerCallback() override;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalyzerService)
+};
@@ -0,0 +1,35 @@
+/*
+  ==============================================================================
+
+    AnalyzerTables.cpp
+    Created: 19 Oct 2026 10:26:41pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "AnalyzerTables.h"
+
+const juce::dsp::FFT& AnalyzerTables::getFFT(FFTOrder order)
+{
+    const juce::ScopedLock sl(lock);
+
+    auto& fft = ffts[getIndex(order)];
+    if (fft == nullptr)
+        fft = std::make_unique<juce::dsp::FFT>(static_cast<int>(order));
+
+    return *fft;
+}
+
+const juce::dsp::WindowingFunction<float>& AnalyzerTables::getWindow(FFTOrder order)
+{
+    const juce::ScopedLock sl(lock);
+
+    auto& window = windows[getIndex(order)];
+    if (window == nullptr)
+        window = std::make_unique<juce::dsp::WindowingFunction<float>>(
+            static_cast<size_t>(1 << static_cast<int>(order)),
+            juce::dsp::WindowingFunction<float>::blackmanHarris);
+
+    return *window;
+}
@@ -0,0 +1,40 @@
+/*
+  ==============================================================================
+
+    AnalyzerTables.h
+    Created: 19 Oct 2026 10:26:41pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <memory>
+#include "../DSP/Constants.h"
+
+/*
+    FFT plans and windowing tables for the analyzer, built the first time an
+    order is asked for and then shared read-only by every analyzer in the
+    process through a juce::SharedResourcePointer.
+*/
+struct AnalyzerTables
+{
+    AnalyzerTables() = default;
+
+    const juce::dsp::FFT& getFFT(FFTOrder order);
+    const juce::dsp::WindowingFunction<float>& getWindow(FFTOrder order);
+
+private:
+    static constexpr int numOrders = order8192 - order2048 + 1;
+
+    juce::CriticalSection lock;
+    std::array<std::unique_ptr<juce::dsp::FFT>, numOrders> ffts;
+    std::array<std::unique_ptr<juce::dsp::WindowingFunction<float>>, numOrders> windows;
+
+    static size_t getIndex(FFTOrder order) { return static_cast<size_t>(order - order2048); }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AnalyzerTables)
+};
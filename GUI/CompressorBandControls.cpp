@@ -16,12 +16,16 @@ CompressorBandControls::CompressorBandControls(juce::AudioProcessorValueTreeStat
     attackSlider(nullptr, "ms", "Attack"),
     releaseSlider(nullptr, "ms", "Release"),
     thresholdSlider(nullptr, "dB", "Threshold"),
+    makeupSlider(nullptr, "dB", "Makeup"),
+    mixSlider(nullptr, "%", "Mix"),
     ratioSlider(nullptr, "")
 {
     addAndMakeVisible(attackSlider);
     addAndMakeVisible(releaseSlider);
     addAndMakeVisible(ratioSlider);
     addAndMakeVisible(thresholdSlider);
+    addAndMakeVisible(makeupSlider);
+    addAndMakeVisible(mixSlider);
 
     bypassButton.addListener(this);
     soloButton.addListener(this);
@@ -129,6 +133,10 @@ void CompressorBandControls::resized()
     flexBox.items.add(spacer);
     flexBox.items.add(juce::FlexItem(thresholdSlider).withFlex(1.0f));
     flexBox.items.add(spacer);
+    flexBox.items.add(juce::FlexItem(makeupSlider).withFlex(1.0f));
+    flexBox.items.add(spacer);
+    flexBox.items.add(juce::FlexItem(mixSlider).withFlex(1.0f));
+    flexBox.items.add(spacer);
 
     flexBox.items.add(juce::FlexItem(bandButtonControlBox).withWidth(30));
 
@@ -137,8 +145,6 @@ void CompressorBandControls::resized()
 }
 void CompressorBandControls::updateBandSelectButtonStates()
 {
-    const auto& paramsMap = Parameters::GetParams();
-
     std::vector<std::array<Parameters::Names, 3>> parametersToCheck
     {
         {{ Parameters::Solo_Low_Band,   Parameters::Mute_Low_Band,   Parameters::Bypassed_Low_Band   }},
@@ -154,17 +160,17 @@ void CompressorBandControls::updateBandSelectButtonStates()
 
         auto& ids = parametersToCheck[i];
 
-        if (auto* p = getBoolParam(apvts, paramsMap, ids[0]); p && p->get())
+        if (auto* p = getBoolParam(apvts, ids[0]); p && p->get())
         {
             refreshBandButtonColors(*bandButton, soloButton);
             continue;
         }
-        if (auto* p = getBoolParam(apvts, paramsMap, ids[1]); p && p->get())
+        if (auto* p = getBoolParam(apvts, ids[1]); p && p->get())
         {
             refreshBandButtonColors(*bandButton, muteButton);
             continue;
         }
-        if (auto* p = getBoolParam(apvts, paramsMap, ids[2]); p && p->get())
+        if (auto* p = getBoolParam(apvts, ids[2]); p && p->get())
         {
             refreshBandButtonColors(*bandButton, bypassButton);
             continue;
@@ -236,6 +242,8 @@ void CompressorBandControls::updateSliderEnablements()
     releaseSlider.setEnabled(!disabled);
     ratioSlider.setEnabled(!disabled);
     thresholdSlider.setEnabled(!disabled);
+    makeupSlider.setEnabled(!disabled);
+    mixSlider.setEnabled(!disabled);
 }
 
 void CompressorBandControls::updateSoloMuteBypassToggleStates(juce::Button& clickedButton)
@@ -272,70 +280,44 @@ void CompressorBandControls::updateAttachments()
     else                                      bandType = High;
 
 
-    Parameters::Names attackID, releaseID, threshID, ratioID,
-        muteID, soloID, bypassID;
+    activeBand = (bandType == Low) ? &lowBandButton
+        : (bandType == Mid) ? &midBandButton
+        : &highBandButton;
 
-
-    switch (bandType)
-    {
-    case Low:
-        attackID = Parameters::Attack_Low_Band;
-        releaseID = Parameters::Release_Low_Band;
-        threshID = Parameters::Threshold_Low_Band;
-        ratioID = Parameters::Ratio_Low_Band;
-        muteID = Parameters::Mute_Low_Band;
-        soloID = Parameters::Solo_Low_Band;
-        bypassID = Parameters::Bypassed_Low_Band;
-        activeBand = &lowBandButton;
-        break;
-
-    case Mid:
-        attackID = Parameters::Attack_Mid_Band;
-        releaseID = Parameters::Release_Mid_Band;
-        threshID = Parameters::Threshold_Mid_Band;
-        ratioID = Parameters::Ratio_Mid_Band;
-        muteID = Parameters::Mute_Mid_Band;
-        soloID = Parameters::Solo_Mid_Band;
-        bypassID = Parameters::Bypassed_Mid_Band;
-        activeBand = &midBandButton;
-        break;
-
-    case High:
-        attackID = Parameters::Attack_High_Band;
-        releaseID = Parameters::Release_High_Band;
-        threshID = Parameters::Threshold_High_Band;
-        ratioID = Parameters::Ratio_High_Band;
-        muteID = Parameters::Mute_High_Band;
-        soloID = Parameters::Solo_High_Band;
-        bypassID = Parameters::Bypassed_High_Band;
-        activeBand = &highBandButton;
-        break;
-    }
+    const auto attackID = Parameters::forBand(Parameters::Attack_Low_Band, bandType);
+    const auto releaseID = Parameters::forBand(Parameters::Release_Low_Band, bandType);
+    const auto threshID = Parameters::forBand(Parameters::Threshold_Low_Band, bandType);
+    const auto ratioID = Parameters::forBand(Parameters::Ratio_Low_Band, bandType);
+    const auto makeupID = Parameters::forBand(Parameters::Makeup_Gain_Low_Band, bandType);
+    const auto mixID = Parameters::forBand(Parameters::Mix_Low_Band, bandType);
+    const auto muteID = Parameters::forBand(Parameters::Mute_Low_Band, bandType);
+    const auto soloID = Parameters::forBand(Parameters::Solo_Low_Band, bandType);
+    const auto bypassID = Parameters::forBand(Parameters::Bypassed_Low_Band, bandType);
 
     attackSliderAttachment.reset();
     releaseSliderAttachment.reset();
     thresholdSliderAttachment.reset();
     ratioSliderAttachment.reset();
+    makeupSliderAttachment.reset();
+    mixSliderAttachment.reset();
     muteButtonAttachment.reset();
     soloButtonAttachment.reset();
     bypassButtonAttachment.reset();
 
-    const auto& paramsMap = Parameters::GetParams();
-
     {
-        auto& p = getRangedParam(apvts, paramsMap, attackID);
+        auto& p = getRangedParam(apvts, attackID);
         attackSlider.changeParam(&p);
         addLabelPairs(attackSlider.labels, p, "ms");
-        makeAttachment(attackSliderAttachment, apvts, paramsMap, attackID, attackSlider);
+        makeAttachment(attackSliderAttachment, apvts, attackID, attackSlider);
     }
     {
-        auto& p = getRangedParam(apvts, paramsMap, releaseID);
+        auto& p = getRangedParam(apvts, releaseID);
         releaseSlider.changeParam(&p);
         addLabelPairs(releaseSlider.labels, p, "ms");
-        makeAttachment(releaseSliderAttachment, apvts, paramsMap, releaseID, releaseSlider);
+        makeAttachment(releaseSliderAttachment, apvts, releaseID, releaseSlider);
     }
     {
-        auto& p = getRangedParam(apvts, paramsMap, ratioID);
+        auto& p = getRangedParam(apvts, ratioID);
         ratioSlider.changeParam(&p);
         ratioSlider.labels.clear();
         if (auto* ratioParam = dynamic_cast<juce::AudioParameterChoice*>(&p))
@@ -349,28 +331,35 @@ void CompressorBandControls::updateAttachments()
                 ratioSlider.labels.add({ 1.f, choices[num - 1] });
             }
         }
-        makeAttachment(ratioSliderAttachment, apvts, paramsMap, ratioID, ratioSlider);
+        makeAttachment(ratioSliderAttachment, apvts, ratioID, ratioSlider);
     }
     {
-        auto& p = getRangedParam(apvts, paramsMap, threshID);
+        auto& p = getRangedParam(apvts, threshID);
         thresholdSlider.changeParam(&p);
         addLabelPairs(thresholdSlider.labels, p, "dB");
-        makeAttachment(thresholdSliderAttachment, apvts, paramsMap, threshID, thresholdSlider);
+        makeAttachment(thresholdSliderAttachment, apvts, threshID, thresholdSlider);
+    }
+    {
+        auto& p = getRangedParam(apvts, makeupID);
+        makeupSlider.changeParam(&p);
+        addLabelPairs(makeupSlider.labels, p, "dB");
+        makeAttachment(makeupSliderAttachment, apvts, makeupID, makeupSlider);
+    }
+    {
+        auto& p = getRangedParam(apvts, mixID);
+        mixSlider.changeParam(&p);
+        addLabelPairs(mixSlider.labels, p, "%");
+        makeAttachment(mixSliderAttachment, apvts, mixID, mixSlider);
     }
 
-    makeAttachment(muteButtonAttachment, apvts, paramsMap, muteID, muteButton);
-    makeAttachment(soloButtonAttachment, apvts, paramsMap, soloID, soloButton);
-    makeAttachment(bypassButtonAttachment, apvts, paramsMap, bypassID, bypassButton);
+    makeAttachment(muteButtonAttachment, apvts, muteID, muteButton);
+    makeAttachment(soloButtonAttachment, apvts, soloID, soloButton);
+    makeAttachment(bypassButtonAttachment, apvts, bypassID, bypassButton);
 }
 
 juce::AudioParameterBool* getBoolParam(
     juce::AudioProcessorValueTreeState& apvts,
-    const std::map<Parameters::Names, juce::String>& paramsMap,
     Parameters::Names paramID)
 {
-    auto* baseParam = apvts.getParameter(paramsMap.at(paramID));
-
-    auto* boolParam = dynamic_cast<juce::AudioParameterBool*>(baseParam);
-    jassert(boolParam != nullptr);
-    return boolParam;
+    return Parameters::get<juce::AudioParameterBool>(apvts.processor, paramID);
 }
@@ -26,11 +26,12 @@ struct CompressorBandControls : juce::Component, juce::Button::Listener
 
 private:
     juce::AudioProcessorValueTreeState& apvts;
-    RotarySliderWithLabels attackSlider, releaseSlider, thresholdSlider;
+    RotarySliderWithLabels attackSlider, releaseSlider, thresholdSlider, makeupSlider, mixSlider;
     RatioSlider ratioSlider;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>
-        attackSliderAttachment, releaseSliderAttachment, thresholdSliderAttachment, ratioSliderAttachment;
+        attackSliderAttachment, releaseSliderAttachment, thresholdSliderAttachment, ratioSliderAttachment,
+        makeupSliderAttachment, mixSliderAttachment;
 
     juce::ToggleButton bypassButton, soloButton, muteButton, lowBandButton, midBandButton, highBandButton;
 
@@ -55,5 +56,4 @@ private:
 
 static juce::AudioParameterBool* getBoolParam(
     juce::AudioProcessorValueTreeState& apvts,
-    const std::map<Parameters::Names, juce::String>& paramsMap,
     Parameters::Names paramID);
@@ -15,6 +15,27 @@ ControlBar::ControlBar()
     analyzerButton.setToggleState(true, juce::NotificationType::dontSendNotification);
     addAndMakeVisible(analyzerButton);
     addAndMakeVisible(globalBypassButton);
+
+#if MBCOMP_PROFILING
+    addAndMakeVisible(performanceButton);
+    addAndMakeVisible(traceButton);
+
+    testSignalSelector.addItem("Input", TestSignalOff + 1);
+    testSignalSelector.addItem("Sine 1k", SineSignal + 1);
+    testSignalSelector.addItem("Pink", PinkNoiseSignal + 1);
+    testSignalSelector.addItem("Sweep", LogSweepSignal + 1);
+    testSignalSelector.addItem("Impulse", ImpulseSignal + 1);
+    testSignalSelector.setSelectedId(TestSignalOff + 1, juce::NotificationType::dontSendNotification);
+    addAndMakeVisible(testSignalSelector);
+#endif
+
+#if MBCOMP_BENCHMARKS
+    addAndMakeVisible(benchmarkButton);
+#endif
+
+#if MBCOMP_REGRESSION_HARNESS
+    addAndMakeVisible(regressionButton);
+#endif
 }
 
 void ControlBar::resized()
@@ -22,4 +43,18 @@ void ControlBar::resized()
     auto bounds = getLocalBounds();
     analyzerButton.setBounds(bounds.removeFromLeft(50).withTrimmedTop(4).withTrimmedBottom(4));
     globalBypassButton.setBounds(bounds.removeFromRight(60).withTrimmedTop(4).withTrimmedBottom(4));
+
+#if MBCOMP_PROFILING
+    performanceButton.setBounds(bounds.removeFromRight(50).withTrimmedTop(4).withTrimmedBottom(4));
+    traceButton.setBounds(bounds.removeFromRight(55).withTrimmedTop(4).withTrimmedBottom(4));
+    testSignalSelector.setBounds(bounds.removeFromRight(80).withTrimmedTop(4).withTrimmedBottom(4));
+#endif
+
+#if MBCOMP_BENCHMARKS
+    benchmarkButton.setBounds(bounds.removeFromRight(55).withTrimmedTop(4).withTrimmedBottom(4));
+#endif
+
+#if MBCOMP_REGRESSION_HARNESS
+    regressionButton.setBounds(bounds.removeFromRight(55).withTrimmedTop(4).withTrimmedBottom(4));
+#endif
 }
@@ -12,6 +12,7 @@
 
 #include <JuceHeader.h>
 #include "PluginButtons.h"
+#include "../DSP/PerformanceMonitor.h"
 
 
 struct ControlBar : juce::Component
@@ -20,5 +21,21 @@ struct ControlBar : juce::Component
     void resized() override;
     AnalyzerButton analyzerButton;
     PowerButton globalBypassButton;
+
+#if MBCOMP_PROFILING
+    juce::ToggleButton performanceButton{ "PERF" };
+    juce::ToggleButton traceButton{ "TRACE" };
+
+    // item ids are the TestSignal values plus one
+    juce::ComboBox testSignalSelector;
+#endif
+
+#if MBCOMP_BENCHMARKS
+    juce::TextButton benchmarkButton{ "BENCH" };
+#endif
+
+#if MBCOMP_REGRESSION_HARNESS
+    juce::TextButton regressionButton{ "GOLD" };
+#endif
 };
 
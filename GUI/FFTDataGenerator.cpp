@@ -20,11 +20,8 @@ void FFTDataGenerator::changeOrder(FFTOrder newOrder)
     order = newOrder;
     auto fftSize = getFFTSize();
 
-    forwardFFT = std::make_unique<juce::dsp::FFT>(static_cast<int>(order));
-    window = std::make_unique<juce::dsp::WindowingFunction<float>>(
-        fftSize,
-        juce::dsp::WindowingFunction<float>::blackmanHarris
-    );
+    forwardFFT = &tables->getFFT(order);
+    window = &tables->getWindow(order);
 
     fftData.clear();
     fftData.resize(fftSize * 2, 0);
@@ -34,6 +31,8 @@ void FFTDataGenerator::changeOrder(FFTOrder newOrder)
 
 void FFTDataGenerator::produceFFTDataForRendering(const juce::AudioBuffer<float>& audioData, float negativeInfinity)
 {
+    MBCOMP_TRACE_SCOPE("FFTDataGenerator::produceFFTDataForRendering");
+
     const auto fftSize = getFFTSize();
 
     fftData.assign(fftData.size(), 0);
@@ -15,6 +15,8 @@
 #include "../PluginProcessor.h"
 #include "../DSP/SingleChannelSampleFIFO.h"
 #include "../DSP/FIFO.h"
+#include "../DSP/TraceRecorder.h"
+#include "AnalyzerTables.h"
 
 class FFTDataGenerator
 {
@@ -32,8 +34,10 @@ private:
     FFTOrder order;
 
     std::vector<float> fftData;
-    std::unique_ptr<juce::dsp::FFT> forwardFFT;
-    std::unique_ptr<juce::dsp::WindowingFunction<float>> window;
+    // shared with every other analyzer in the process
+    juce::SharedResourcePointer<AnalyzerTables> tables;
+    const juce::dsp::FFT* forwardFFT{ nullptr };
+    const juce::dsp::WindowingFunction<float>* window{ nullptr };
 
     Fifo<std::vector<float>> fftDataFifo;
 
@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    GainReductionScope.cpp
+    Created: 19 Oct 2026 5:08:37pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "GainReductionScope.h"
+#include "../Service/UtilityFunctions.h"
+
+namespace
+{
+    const std::array<juce::Colour, 3> bandColours
+    {
+        juce::Colour(97u, 18u, 167u),
+        juce::Colour(215u, 201u, 134u),
+        juce::Colour(0xff00fff9)
+    };
+}
+
+GainReductionScope::GainReductionScope(RepaintScheduler& scheduler) :
+    repaintScheduler(scheduler)
+{
+    setOpaque(true);
+}
+
+juce::Rectangle<int> GainReductionScope::getScopeArea() const
+{
+    auto bounds = getLocalBounds().reduced(3);
+    bounds.removeFromLeft(20);
+    bounds.removeFromRight(4);
+    return bounds.reduced(0, 4);
+}
+
+float GainReductionScope::mapGainReduction(float gainReductionDb) const
+{
+    // image space: 0 dB reduction along the top edge
+    return juce::jmap(juce::jlimit(0.0f, GR_SCOPE_RANGE_DB, gainReductionDb),
+        0.0f, GR_SCOPE_RANGE_DB, 0.0f, static_cast<float>(historyImage.getHeight() - 1));
+}
+
+void GainReductionScope::resized()
+{
+    const auto area = getScopeArea();
+    if (area.isEmpty())
+        return;
+
+    const int historyFrames = GR_HISTORY_SECONDS * METER_RATE_HZ;
+    framesPerColumn = juce::jmax(1, (historyFrames + area.getWidth() - 1) / area.getWidth());
+
+    // keep the newest columns that still fit
+    std::vector<Column> resizedColumns(static_cast<size_t>(area.getWidth()));
+    const int numOld = static_cast<int>(columns.size());
+    const int numKept = juce::jmin(numOld, area.getWidth());
+    for (int i = 0; i < numKept; ++i)
+    {
+        const int source = (nextColumn - numKept + i + numOld) % juce::jmax(1, numOld);
+        resizedColumns[static_cast<size_t>(area.getWidth() - numKept + i)] = columns[static_cast<size_t>(source)];
+    }
+
+    columns = std::move(resizedColumns);
+    nextColumn = 0;
+
+    historyImage = juce::Image(juce::Image::ARGB, area.getWidth(), area.getHeight(), true);
+    redrawHistory();
+}
+
+void GainReductionScope::redrawHistory()
+{
+    historyImage.clear(historyImage.getBounds());
+    juce::Graphics g(historyImage);
+
+    const int width = static_cast<int>(columns.size());
+    for (int x = 0; x < width; ++x)
+        drawColumn(g, columns[static_cast<size_t>((nextColumn + x) % width)], x);
+}
+
+void GainReductionScope::drawColumn(juce::Graphics& g, const Column& column, int x)
+{
+    for (size_t band = 0; band < column.minDb.size(); ++band)
+    {
+        const float top = mapGainReduction(column.minDb[band]);
+        const float bottom = mapGainReduction(column.maxDb[band]);
+
+        g.setColour(bandColours[band]);
+        g.drawVerticalLine(x, top, juce::jmax(top + 1.0f, bottom + 1.0f));
+    }
+}
+
+void GainReductionScope::addFrameToPendingColumn(const MeterFrame& frame)
+{
+    for (size_t band = 0; band < frame.bands.size(); ++band)
+    {
+        const float gr = frame.bands[band].getMaxGainReductionDb();
+
+        if (framesInPendingColumn == 0)
+        {
+            pendingColumn.minDb[band] = gr;
+            pendingColumn.maxDb[band] = gr;
+        }
+        else
+        {
+            pendingColumn.minDb[band] = juce::jmin(pendingColumn.minDb[band], gr);
+            pendingColumn.maxDb[band] = juce::jmax(pendingColumn.maxDb[band], gr);
+        }
+    }
+
+    ++framesInPendingColumn;
+}
+
+void GainReductionScope::update(const MeterFrame* frames, int numFrames)
+{
+    const int width = static_cast<int>(columns.size());
+    if (width == 0 || !historyImage.isValid())
+        return;
+
+    int numNewColumns = 0;
+
+    for (int i = 0; i < numFrames; ++i)
+    {
+        addFrameToPendingColumn(frames[i]);
+
+        if (framesInPendingColumn == framesPerColumn)
+        {
+            columns[static_cast<size_t>(nextColumn)] = pendingColumn;
+            nextColumn = (nextColumn + 1) % width;
+            framesInPendingColumn = 0;
+            ++numNewColumns;
+        }
+    }
+
+    if (numNewColumns == 0)
+        return;
+
+    numNewColumns = juce::jmin(numNewColumns, width);
+
+    // scroll what is already drawn and paint only the columns that just arrived
+    const int height = historyImage.getHeight();
+    historyImage.moveImageSection(0, 0, numNewColumns, 0, width - numNewColumns, height);
+    historyImage.clear({ width - numNewColumns, 0, numNewColumns, height });
+
+    {
+        juce::Graphics g(historyImage);
+        for (int i = 0; i < numNewColumns; ++i)
+        {
+            const int column = (nextColumn - numNewColumns + i + width) % width;
+            drawColumn(g, columns[static_cast<size_t>(column)], width - numNewColumns + i);
+        }
+    }
+
+    repaintScheduler.invalidate(*this, getScopeArea());
+}
+
+void GainReductionScope::paint(juce::Graphics& g)
+{
+    MBCOMP_TRACE_SCOPE("GainReductionScope::paint");
+
+    g.fillAll(juce::Colours::black);
+    drawModuleBackground(g, getLocalBounds());
+
+    const auto area = getScopeArea();
+
+    g.setColour(juce::Colours::darkgrey);
+    g.setFont(10);
+    for (float db = 0.0f; db <= GR_SCOPE_RANGE_DB; db += 6.0f)
+    {
+        const float y = area.getY() + mapGainReduction(db);
+        g.drawHorizontalLine(juce::roundToInt(y), area.getX(), area.getRight());
+
+        g.setColour(juce::Colours::lightgrey);
+        g.drawFittedText(juce::String(-juce::roundToInt(db)), { 3, juce::roundToInt(y) - 5, 18, 10 }, juce::Justification::centredLeft, 1);
+        g.setColour(juce::Colours::darkgrey);
+    }
+
+    g.drawImageAt(historyImage, area.getX(), area.getY());
+}
@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    GainReductionScope.h
+    Created: 19 Oct 2026 5:08:37pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+#include "../DSP/Constants.h"
+#include "../DSP/Metering.h"
+#include "RepaintScheduler.h"
+#include "../DSP/TraceRecorder.h"
+
+/*
+    Scrolling gain reduction history, one trace per band, newest on the right.
+
+    Meter frames are folded into columns of min/max gain reduction, kept in a
+    ring buffer one column per pixel. The traces live in a cached image: new
+    columns shift it left and draw only themselves, so the cost per tick does
+    not depend on how much history is on screen. The whole image is only
+    redrawn from the ring buffer after a resize.
+*/
+struct GainReductionScope : juce::Component
+{
+    explicit GainReductionScope(RepaintScheduler& scheduler);
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+
+    void update(const MeterFrame* frames, int numFrames);
+
+private:
+    struct Column
+    {
+        std::array<float, 3> minDb{};
+        std::array<float, 3> maxDb{};
+    };
+
+    juce::Rectangle<int> getScopeArea() const;
+    float mapGainReduction(float gainReductionDb) const;
+
+    void addFrameToPendingColumn(const MeterFrame& frame);
+    void drawColumn(juce::Graphics& g, const Column& column, int x);
+    void redrawHistory();
+
+    RepaintScheduler& repaintScheduler;
+
+    std::vector<Column> columns;
+    int nextColumn{ 0 };
+
+    Column pendingColumn;
+    int framesInPendingColumn{ 0 };
+    int framesPerColumn{ 1 };
+
+    juce::Image historyImage;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GainReductionScope)
+};
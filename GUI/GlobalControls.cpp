@@ -12,54 +12,58 @@
 
 GlobalControls::GlobalControls(juce::AudioProcessorValueTreeState& apvts)
 {
-    const auto& paramsMap = Parameters::GetParams();
-
-    auto& inGainParam = getRangedParam(apvts, paramsMap, Parameters::Input_Gain);
-    auto& lowMidParam = getRangedParam(apvts, paramsMap, Parameters::Low_Mid_Crossover_Freq);
-    auto& midHighParam = getRangedParam(apvts, paramsMap, Parameters::Mid_High_Crossover_Freq);
-    auto& outGainParam = getRangedParam(apvts, paramsMap, Parameters::Output_Gain);
+    auto& inGainParam = getRangedParam(apvts, Parameters::Input_Gain);
+    auto& lowMidParam = getRangedParam(apvts, Parameters::Low_Mid_Crossover_Freq);
+    auto& midHighParam = getRangedParam(apvts, Parameters::Mid_High_Crossover_Freq);
+    auto& mixParam = getRangedParam(apvts, Parameters::Mix);
+    auto& outGainParam = getRangedParam(apvts, Parameters::Output_Gain);
 
     inputGainSlider = std::make_unique<RotarySliderWithLabels>(&inGainParam, " dB", "Input Gain");
     lowMidCrossoverSlider = std::make_unique<RotarySliderWithLabels>(&lowMidParam, " Hz", "Low Mid Crossover");
     midHighCrossoverSlider = std::make_unique<RotarySliderWithLabels>(&midHighParam, " Hz", "Mid High Crossover");
+    mixSlider = std::make_unique<RotarySliderWithLabels>(&mixParam, " %", "Mix");
     outputGainSlider = std::make_unique<RotarySliderWithLabels>(&outGainParam, " dB", "Output Gain");
 
     makeAttachment(
         inputGainSliderAttachment,
         apvts,
-        paramsMap,
         Parameters::Input_Gain,
         *inputGainSlider);
 
     makeAttachment(
         lowMidCrossoverSliderAttachment,
         apvts,
-        paramsMap,
         Parameters::Low_Mid_Crossover_Freq,
         *lowMidCrossoverSlider);
 
     makeAttachment(
         midHighCrossoverSliderAttachment,
         apvts,
-        paramsMap,
         Parameters::Mid_High_Crossover_Freq,
         *midHighCrossoverSlider);
 
+    makeAttachment(
+        mixSliderAttachment,
+        apvts,
+        Parameters::Mix,
+        *mixSlider);
+
     makeAttachment(
         outputGainSliderAttachment,
         apvts,
-        paramsMap,
         Parameters::Output_Gain,
         *outputGainSlider);
 
     addLabelPairs(inputGainSlider->labels, inGainParam, "dB");
     addLabelPairs(lowMidCrossoverSlider->labels, lowMidParam, "Hz");
     addLabelPairs(midHighCrossoverSlider->labels, midHighParam, "Hz");
+    addLabelPairs(mixSlider->labels, mixParam, "%");
     addLabelPairs(outputGainSlider->labels, outGainParam, "dB");
 
     addAndMakeVisible(*inputGainSlider);
     addAndMakeVisible(*lowMidCrossoverSlider);
     addAndMakeVisible(*midHighCrossoverSlider);
+    addAndMakeVisible(*mixSlider);
     addAndMakeVisible(*outputGainSlider);
 }
 
@@ -88,6 +92,8 @@ void GlobalControls::resized()
     flexBox.items.add(spacer);
     flexBox.items.add(juce::FlexItem(*midHighCrossoverSlider).withFlex(1.0f));
     flexBox.items.add(spacer);
+    flexBox.items.add(juce::FlexItem(*mixSlider).withFlex(1.0f));
+    flexBox.items.add(spacer);
     flexBox.items.add(juce::FlexItem(*outputGainSlider).withFlex(1.0f));
     flexBox.items.add(endCap);
 
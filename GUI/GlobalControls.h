@@ -22,9 +22,9 @@ struct GlobalControls : juce::Component
     void resized() override;
 
 private:
-    std::unique_ptr<RotarySliderWithLabels> inputGainSlider, lowMidCrossoverSlider, midHighCrossoverSlider, outputGainSlider;
+    std::unique_ptr<RotarySliderWithLabels> inputGainSlider, lowMidCrossoverSlider, midHighCrossoverSlider, mixSlider, outputGainSlider;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>
-        inputGainSliderAttachment, lowMidCrossoverSliderAttachment, midHighCrossoverSliderAttachment, outputGainSliderAttachment;
+        inputGainSliderAttachment, lowMidCrossoverSliderAttachment, midHighCrossoverSliderAttachment, mixSliderAttachment, outputGainSliderAttachment;
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GlobalControls)
 };
\ No newline at end of file
@@ -20,11 +20,14 @@ void LookAndFeel::drawRotarySlider(juce::Graphics& g,
     float rotaryEndAngle,
     juce::Slider& slider)
 {
-    using namespace juce;
-
-    auto bounds = Rectangle<float>(x, y, width, height);
+    // plain sliders only get the body; RotarySliderWithLabels draws through the typed calls below
+    juce::ignoreUnused(sliderPosProportional, rotaryStartAngle, rotaryEndAngle);
+    drawRotarySliderBody(g, juce::Rectangle<float>(x, y, width, height), slider.isEnabled());
+}
 
-    auto enabled = slider.isEnabled();
+void LookAndFeel::drawRotarySliderBody(juce::Graphics& g, juce::Rectangle<float> bounds, bool enabled)
+{
+    using namespace juce;
 
     //g.setColour(enabled ? Colour(97u, 18u, 167u) : Colours::darkgrey);
     g.setColour(enabled ? ColorScheme::getModuleBorderColor() : Colours::darkgrey);
@@ -33,41 +36,48 @@ void LookAndFeel::drawRotarySlider(juce::Graphics& g,
     //g.setColour(enabled ? Colour(255u, 154u, 1u) : Colours::grey);
     g.setColour(enabled ? ColorScheme::getSliderBorderColor() : Colours::grey);
     g.drawEllipse(bounds, 1.f);
+}
 
-    if (auto* rswl = dynamic_cast<RotarySliderWithLabels*>(&slider))
-    {
-        auto center = bounds.getCentre();
-        Path p;
-
-        Rectangle<float> r;
-        r.setLeft(center.getX() - 2);
-        r.setRight(center.getX() + 2);
-        r.setTop(bounds.getY());
-        r.setBottom(center.getY() - rswl->getTextHeight() * 1.5);
-
-        p.addRoundedRectangle(r, 2.f);
+void LookAndFeel::drawRotarySliderPointer(juce::Graphics& g,
+    juce::Rectangle<float> bounds,
+    float sliderPosProportional,
+    float rotaryStartAngle,
+    float rotaryEndAngle,
+    const RotarySliderWithLabels& slider)
+{
+    using namespace juce;
 
-        jassert(rotaryStartAngle < rotaryEndAngle);
+    auto enabled = slider.isEnabled();
+    auto textHeight = slider.getTextHeight();
+    auto center = bounds.getCentre();
 
-        auto sliderAngRad = jmap(sliderPosProportional, 0.f, 1.f, rotaryStartAngle, rotaryEndAngle);
+    jassert(rotaryStartAngle < rotaryEndAngle);
 
-        p.applyTransform(AffineTransform().rotated(sliderAngRad, center.getX(), center.getY()));
+    auto sliderAngRad = jmap(sliderPosProportional, 0.f, 1.f, rotaryStartAngle, rotaryEndAngle);
 
-        g.fillPath(p);
+    // a rounded bar from the rim towards the centre, rotated into place
+    Rectangle<float> r;
+    r.setLeft(center.getX() - 2);
+    r.setRight(center.getX() + 2);
+    r.setTop(bounds.getY());
+    r.setBottom(center.getY() - textHeight * 1.5);
 
-        g.setFont(rswl->getTextHeight());
-        auto text = rswl->getDisplayString();
-        auto strWidth = g.getCurrentFont().getStringWidth(text);
+    g.setColour(enabled ? ColorScheme::getSliderBorderColor() : Colours::grey);
+    {
+        Graphics::ScopedSaveState sss(g);
+        g.addTransform(AffineTransform::rotation(sliderAngRad, center.getX(), center.getY()));
+        g.fillRoundedRectangle(r, 2.f);
+    }
 
-        r.setSize(strWidth + 4, rswl->getTextHeight() + 2);
-        r.setCentre(bounds.getCentre());
+    r.setSize(slider.getCachedDisplayStringWidth() + 4, textHeight + 2);
+    r.setCentre(center);
 
-        g.setColour(enabled ? Colours::black : Colours::darkgrey);
-        g.fillRect(r);
+    g.setColour(enabled ? Colours::black : Colours::darkgrey);
+    g.fillRect(r);
 
-        g.setColour(enabled ? Colours::white : Colours::lightgrey);
-        g.drawFittedText(text, r.toNearestInt(), juce::Justification::centred, 1);
-    }
+    g.setFont(textHeight);
+    g.setColour(enabled ? Colours::white : Colours::lightgrey);
+    g.drawFittedText(slider.getCachedDisplayString(), r.toNearestInt(), juce::Justification::centred, 1);
 }
 
 void LookAndFeel::drawToggleButton(juce::Graphics& g,
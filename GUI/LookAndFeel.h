@@ -45,6 +45,16 @@ struct LookAndFeel : juce::LookAndFeel_V4
         float rotaryEndAngle,
         juce::Slider&) override;
 
+    // RotarySliderWithLabels calls these directly: the body goes into its cached static layer,
+    // the pointer and value box are all that is drawn per repaint
+    void drawRotarySliderBody(juce::Graphics& g, juce::Rectangle<float> bounds, bool enabled);
+    void drawRotarySliderPointer(juce::Graphics& g,
+        juce::Rectangle<float> bounds,
+        float sliderPosProportional,
+        float rotaryStartAngle,
+        float rotaryEndAngle,
+        const RotarySliderWithLabels& slider);
+
     void drawToggleButton(juce::Graphics& g,
         juce::ToggleButton& toggleButton,
         bool shouldDrawButtonAsHighlighted,
@@ -12,12 +12,15 @@
 PathProducer::PathProducer(SingleChannelSampleFifo<juce::AudioBuffer<float>>& scsf)
     : leftChannelFifo(&scsf)
 {
-    leftChannelFFTDataGenerator.changeOrder(order2048);
     monoBuffer.setSize(1, leftChannelFFTDataGenerator.getFFTSize());
 }
 
 void PathProducer::process(juce::Rectangle<float> fftBounds, double sampleRate)
 {
+    MBCOMP_TRACE_SCOPE("PathProducer::process");
+
+    const float floor = negativeInfinity.load(std::memory_order_relaxed);
+
     juce::AudioBuffer<float> tempIncomingBuffer;
 
     while (leftChannelFifo->getNumCompleteBuffersAvailable() > 0)
@@ -40,7 +43,7 @@ void PathProducer::process(juce::Rectangle<float> fftBounds, double sampleRate)
                 tempIncomingBuffer.getReadPointer(0, 0),
                 size);
 
-            leftChannelFFTDataGenerator.produceFFTDataForRendering(monoBuffer, negativeInfinity);
+            leftChannelFFTDataGenerator.produceFFTDataForRendering(monoBuffer, floor);
         }
     }
 
@@ -52,14 +55,20 @@ void PathProducer::process(juce::Rectangle<float> fftBounds, double sampleRate)
         std::vector<float> fftData;
         if (leftChannelFFTDataGenerator.getFFTData(fftData))
         {
-            pathProducer.generatePath(fftData, fftBounds, fftSize, binWidth, negativeInfinity);
+            pathProducer.generatePath(fftData, fftBounds, fftSize, binWidth, floor);
         }
     }
+}
 
+bool PathProducer::pullPath()
+{
+    bool newPath = false;
     while (pathProducer.getNumPathsAvailable() > 0)
     {
-        pathProducer.getPath(leftChannelFFTPath);
+        newPath = pathProducer.getPath(leftChannelFFTPath) || newPath;
     }
+
+    return newPath;
 }
 
 juce::Path PathProducer::getPath() const
@@ -69,5 +78,5 @@ juce::Path PathProducer::getPath() const
 
 void PathProducer::setNegativeInfinity(float newValue)
 {
-    negativeInfinity = newValue;
+    negativeInfinity.store(newValue, std::memory_order_relaxed);
 }
\ No newline at end of file
@@ -24,7 +24,11 @@ class PathProducer
 public:
     explicit PathProducer(SingleChannelSampleFifo<juce::AudioBuffer<float>>& scsf);
 
+    /** Analyzer worker: turns every complete sample buffer into FFT data and queues the resulting path. */
     void process(juce::Rectangle<float> fftBounds, double sampleRate);
+
+    /** Message thread: takes the newest queued path, returns true if there was one. */
+    bool pullPath();
     juce::Path getPath() const;
 
     void setNegativeInfinity(float newValue);
@@ -38,7 +42,7 @@ private:
 
     juce::Path leftChannelFFTPath;
 
-    float negativeInfinity{ -48.f };
+    std::atomic<float> negativeInfinity{ -48.f };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PathProducer)
 };
\ No newline at end of file
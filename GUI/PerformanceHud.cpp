@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    PerformanceHud.cpp
+    Created: 19 Oct 2026 6:34:12pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "PerformanceHud.h"
+
+namespace
+{
+    // editor frames between snapshots, 60 Hz / 6 = 10 refreshes a second
+    constexpr int framesPerRefresh = 6;
+
+    constexpr int lineHeight = 13;
+    constexpr int verticalPadding = 4;
+
+    // load, peak, the stages, analyzer, paint, the two drop counters and the bounce speed
+    constexpr int numLines = 2 + NumProfileStages + 5 + (MBCOMP_REALTIME_CHECKS ? 1 : 0);
+
+    const std::array<const char*, NumProfileStages> stageNames
+    {
+        "input tap",
+        "input gain",
+        "split",
+        "low band",
+        "mid band",
+        "high band",
+        "sum",
+        "output gain"
+    };
+}
+
+PerformanceHud::PerformanceHud(MBCompAudioProcessor& p, RepaintScheduler& scheduler) :
+    audioProcessor(p),
+    repaintScheduler(scheduler)
+{
+    setInterceptsMouseClicks(false, false);
+    setVisible(false);
+}
+
+void PerformanceHud::setActive(bool shouldBeActive)
+{
+    audioProcessor.performanceMonitor.setEnabled(shouldBeActive);
+    setVisible(shouldBeActive);
+    framesUntilRefresh = 0;
+}
+
+int PerformanceHud::getPreferredHeight() const
+{
+    return numLines * lineHeight + 2 * verticalPadding;
+}
+
+void PerformanceHud::update()
+{
+    if (!isVisible() || --framesUntilRefresh > 0)
+        return;
+
+    framesUntilRefresh = framesPerRefresh;
+
+    auto& monitor = audioProcessor.performanceMonitor;
+
+    snapshot.load = monitor.getDspLoad();
+    snapshot.peakLoad = monitor.takePeakLoad();
+
+    for (int stage = 0; stage < NumProfileStages; ++stage)
+        snapshot.stageMicros[stage] = monitor.getStageMicros(stage);
+
+    snapshot.analyzerMicros = monitor.analyzerMicros;
+    snapshot.paintMicros = monitor.paintMicros;
+    snapshot.analyzerDrops = audioProcessor.leftChannelFifo.getNumDroppedBuffers()
+        + audioProcessor.rightChannelFifo.getNumDroppedBuffers();
+    snapshot.meterDrops = audioProcessor.meterFifo.getNumDropped();
+    snapshot.realtimeViolations = RealtimeSafety::getNumViolations();
+    snapshot.renderSpeed = audioProcessor.renderThroughput.getSpeed(audioProcessor.getSampleRate());
+
+    repaintScheduler.invalidate(*this);
+}
+
+void PerformanceHud::paint(juce::Graphics& g)
+{
+    using namespace juce;
+
+    auto bounds = getLocalBounds().toFloat();
+
+    g.setColour(Colours::black.withAlpha(0.7f));
+    g.fillRoundedRectangle(bounds, 4.0f);
+
+    g.setFont(Font(Font::getDefaultMonospacedFontName(), 11.0f, Font::plain));
+
+    auto textArea = getLocalBounds().reduced(6, verticalPadding);
+
+    auto drawLine = [&g, &textArea](const String& label, const String& value, Colour colour)
+        {
+            auto line = textArea.removeFromTop(lineHeight);
+            g.setColour(colour);
+            g.drawFittedText(label, line, Justification::centredLeft, 1);
+            g.drawFittedText(value, line, Justification::centredRight, 1);
+        };
+
+    auto formatMicros = [](float micros) { return String(micros, 1) + " us"; };
+
+    const auto loadColour = snapshot.peakLoad > 1.0f ? Colours::red
+        : snapshot.peakLoad > 0.7f ? Colours::orange
+        : Colour(0u, 172u, 1u);
+
+    drawLine("dsp load", String(snapshot.load * 100.0f, 1) + "%", loadColour);
+    drawLine("peak", String(snapshot.peakLoad * 100.0f, 1) + "%", loadColour);
+
+    for (int stage = 0; stage < NumProfileStages; ++stage)
+        drawLine(stageNames[stage], formatMicros(snapshot.stageMicros[stage]), Colours::lightgrey);
+
+    drawLine("analyzer", formatMicros(snapshot.analyzerMicros), Colours::lightblue);
+    drawLine("paint", formatMicros(snapshot.paintMicros), Colours::lightblue);
+    drawLine("fft drops", String(snapshot.analyzerDrops), Colours::lightblue);
+    drawLine("meter drops", String(snapshot.meterDrops), Colours::lightblue);
+    drawLine("bounce speed", snapshot.renderSpeed > 0.0 ? String(snapshot.renderSpeed, 1) + "x" : String("-"),
+        Colours::lightblue);
+
+#if MBCOMP_REALTIME_CHECKS
+    drawLine("rt violations", String(snapshot.realtimeViolations),
+        snapshot.realtimeViolations > 0 ? Colours::red : Colours::lightblue);
+#endif
+}
@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    PerformanceHud.h
+    Created: 19 Oct 2026 6:34:12pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include "../PluginProcessor.h"
+#include "RepaintScheduler.h"
+
+/*
+    Translucent overlay with the audio thread load, the per stage DSP timings,
+    the analyzer and paint times and the FIFO drop counts. It only reads
+    atomics the processor already publishes, and refreshes its snapshot a few
+    times a second so the numbers stay legible.
+*/
+struct PerformanceHud : juce::Component
+{
+    PerformanceHud(MBCompAudioProcessor& p, RepaintScheduler& scheduler);
+
+    void paint(juce::Graphics& g) override;
+
+    /** Turns the processor's timers on or off along with the overlay. */
+    void setActive(bool shouldBeActive);
+
+    /** Called once per editor frame. */
+    void update();
+
+    int getPreferredHeight() const;
+
+private:
+    MBCompAudioProcessor& audioProcessor;
+    RepaintScheduler& repaintScheduler;
+
+    struct Snapshot
+    {
+        float load{ 0.0f };
+        float peakLoad{ 0.0f };
+        std::array<float, NumProfileStages> stageMicros{};
+        float analyzerMicros{ 0.0f };
+        float paintMicros{ 0.0f };
+        int analyzerDrops{ 0 };
+        int meterDrops{ 0 };
+        int realtimeViolations{ 0 };
+        double renderSpeed{ 0.0 };
+    };
+
+    Snapshot snapshot;
+    int framesUntilRefresh{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PerformanceHud)
+};
@@ -0,0 +1,40 @@
+/*
+  ==============================================================================
+
+    RepaintScheduler.cpp
+    Created: 19 Oct 2026 5:41:19pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "RepaintScheduler.h"
+
+void RepaintScheduler::invalidate(juce::Component& component, juce::Rectangle<int> area)
+{
+    if (area.isEmpty())
+        return;
+
+    // a handful of components per frame, a linear search is cheaper than anything clever
+    for (auto& region : dirtyRegions)
+    {
+        if (region.component.getComponent() == &component)
+        {
+            region.area = region.area.getUnion(area);
+            return;
+        }
+    }
+
+    dirtyRegions.push_back({ &component, area });
+}
+
+void RepaintScheduler::flush()
+{
+    for (auto& region : dirtyRegions)
+    {
+        if (auto* component = region.component.getComponent())
+            component->repaint(region.area);
+    }
+
+    dirtyRegions.clear();
+}
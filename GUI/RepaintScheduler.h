@@ -0,0 +1,41 @@
+/*
+  ==============================================================================
+
+    RepaintScheduler.h
+    Created: 19 Oct 2026 5:41:19pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <vector>
+
+/*
+    Collects the regions that changed during one editor frame and turns them
+    into a single repaint per component when the frame is flushed. Components
+    report only the rectangles whose data moved; anything left untouched in a
+    frame is never invalidated.
+*/
+struct RepaintScheduler
+{
+    RepaintScheduler() = default;
+
+    void invalidate(juce::Component& component, juce::Rectangle<int> area);
+    void invalidate(juce::Component& component) { invalidate(component, component.getLocalBounds()); }
+
+    /** Called once at the end of each editor frame. */
+    void flush();
+
+private:
+    struct DirtyRegion
+    {
+        juce::Component::SafePointer<juce::Component> component;
+        juce::Rectangle<int> area;
+    };
+
+    std::vector<DirtyRegion> dirtyRegions;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RepaintScheduler)
+};
@@ -9,15 +9,68 @@
 */
 
 #include "RotarySliderWithLabels.h"
+#include "LookAndFeel.h"
+
+namespace
+{
+    const float startAngle = juce::degreesToRadians(180.f + 45.f);
+    const float endAngle = juce::degreesToRadians(180.f - 45.f) + juce::MathConstants<float>::twoPi;
+}
 
 void RotarySliderWithLabels::paint(juce::Graphics& g)
 {
     using namespace juce;
 
-    auto startAng = degreesToRadians(180.f + 45.f);
-    auto endAng = degreesToRadians(180.f - 45.f) + MathConstants<float>::twoPi;
+    updateLookAndFeel();
+
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!staticLayer.isValid() || scale != staticLayerScale || labels != staticLayerLabels)
+    {
+        renderStaticLayer(scale);
+    }
+
+    g.drawImageTransformed(staticLayer, AffineTransform::scale(1.0f / staticLayerScale));
+
+    if (displayStringIsStale)
+    {
+        updateDisplayString();
+    }
 
     auto range = getRange();
+    auto sliderBounds = getSliderBounds();
+    auto sliderPos = (float)jmap(getValue(), range.getStart(), range.getEnd(), 0.0, 1.0);
+
+    if (customLookAndFeel != nullptr)
+    {
+        customLookAndFeel->drawRotarySliderPointer(g, sliderBounds.toFloat(), sliderPos, startAngle, endAngle, *this);
+    }
+    else
+    {
+        getLookAndFeel().drawRotarySlider(g,
+            sliderBounds.getX(),
+            sliderBounds.getY(),
+            sliderBounds.getWidth(),
+            sliderBounds.getHeight(),
+            sliderPos,
+            startAngle,
+            endAngle,
+            *this);
+    }
+}
+
+void RotarySliderWithLabels::renderStaticLayer(float scale)
+{
+    using namespace juce;
+
+    staticLayerScale = scale;
+    staticLayerLabels = labels;
+    staticLayer = Image(Image::ARGB,
+        jmax(1, roundToInt(getWidth() * scale)),
+        jmax(1, roundToInt(getHeight() * scale)),
+        true);
+
+    Graphics g(staticLayer);
+    g.addTransform(AffineTransform::scale(scale));
 
     auto sliderBounds = getSliderBounds();
 
@@ -26,16 +79,10 @@ void RotarySliderWithLabels::paint(juce::Graphics& g)
     g.setColour(juce::Colours::blueviolet);
     g.drawFittedText(getName(), bounds.removeFromTop(getTextHeight() + 2), juce::Justification::centredBottom, 1);
 
-
-    getLookAndFeel().drawRotarySlider(g,
-        sliderBounds.getX(),
-        sliderBounds.getY(),
-        sliderBounds.getWidth(),
-        sliderBounds.getHeight(),
-        jmap(getValue(), range.getStart(), range.getEnd(), 0.0, 1.0),
-        startAng,
-        endAng,
-        *this);
+    if (customLookAndFeel != nullptr)
+    {
+        customLookAndFeel->drawRotarySliderBody(g, sliderBounds.toFloat(), isEnabled());
+    }
 
     auto center = sliderBounds.toFloat().getCentre();
     auto radius = sliderBounds.getWidth() * 0.5f;
@@ -50,7 +97,7 @@ void RotarySliderWithLabels::paint(juce::Graphics& g)
         jassert(0.f <= pos);
         jassert(pos <= 1.f);
 
-        auto ang = jmap(pos, 0.f, 1.f, startAng, endAng);
+        auto ang = jmap(pos, 0.f, 1.f, startAngle, endAngle);
 
         auto c = center.getPointOnCircumference(radius + getTextHeight() * 0.5f + 1, ang);
 
@@ -62,7 +109,62 @@ void RotarySliderWithLabels::paint(juce::Graphics& g)
 
         g.drawFittedText(str, r.toNearestInt(), juce::Justification::centred, 1);
     }
+}
+
+void RotarySliderWithLabels::resized()
+{
+    juce::Slider::resized();
+    staticLayer = juce::Image();
+}
+
+void RotarySliderWithLabels::valueChanged()
+{
+    displayStringIsStale = true;
+}
+
+void RotarySliderWithLabels::enablementChanged()
+{
+    juce::Slider::enablementChanged();
+    staticLayer = juce::Image();
+    repaint();
+}
+
+void RotarySliderWithLabels::lookAndFeelChanged()
+{
+    juce::Slider::lookAndFeelChanged();
 
+    // the same look and feel may have changed its colours, so the layer goes either way
+    updateLookAndFeel();
+    staticLayer = juce::Image();
+}
+
+void RotarySliderWithLabels::parentHierarchyChanged()
+{
+    juce::Slider::parentHierarchyChanged();
+    updateLookAndFeel();
+}
+
+void RotarySliderWithLabels::updateLookAndFeel()
+{
+    auto* current = &getLookAndFeel();
+    if (current == resolvedLookAndFeel)
+        return;
+
+    resolvedLookAndFeel = current;
+    customLookAndFeel = dynamic_cast<LookAndFeel*>(current);
+    staticLayer = juce::Image();
+}
+
+void RotarySliderWithLabels::updateDisplayString()
+{
+    displayStringIsStale = false;
+    auto text = param != nullptr ? getDisplayString() : juce::String();
+
+    if (text != cachedDisplayString)
+    {
+        cachedDisplayString = text;
+        cachedDisplayStringWidth = juce::Font(static_cast<float>(getTextHeight())).getStringWidth(cachedDisplayString);
+    }
 }
 
 juce::Rectangle<int> RotarySliderWithLabels::getSliderBounds() const
@@ -123,6 +225,7 @@ juce::String RotarySliderWithLabels::getDisplayString() const
 void RotarySliderWithLabels::changeParam(juce::RangedAudioParameter* p)
 {
     param = p;
+    displayStringIsStale = true;
     repaint();
 }
 
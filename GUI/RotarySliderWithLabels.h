@@ -12,6 +12,14 @@
 
 #include <JuceHeader.h>
 
+struct LookAndFeel;
+
+/*
+    Everything that does not move with the value (title, range labels and the
+    knob body) is rendered once into a static layer; a repaint while dragging
+    only blits that and draws the pointer and the value box on top. The value
+    string and its measured width are rebuilt only when the value changes.
+*/
 struct RotarySliderWithLabels : juce::Slider
 {
     RotarySliderWithLabels(juce::RangedAudioParameter* rap,
@@ -29,6 +37,9 @@ struct RotarySliderWithLabels : juce::Slider
     {
         float pos;
         juce::String label;
+
+        bool operator==(const LabelPos& other) const { return pos == other.pos && label == other.label; }
+        bool operator!=(const LabelPos& other) const { return !(*this == other); }
     };
 
     juce::Array<LabelPos> labels;
@@ -39,11 +50,38 @@ struct RotarySliderWithLabels : juce::Slider
     virtual juce::String getDisplayString() const;
     void changeParam(juce::RangedAudioParameter* p);
 
+    /** Value text as of the last paint, and its width at getTextHeight(). */
+    const juce::String& getCachedDisplayString() const { return cachedDisplayString; }
+    int getCachedDisplayStringWidth() const { return cachedDisplayStringWidth; }
+
+    void resized() override;
+    void valueChanged() override;
+    void enablementChanged() override;
+    void lookAndFeelChanged() override;
+    void parentHierarchyChanged() override;
+
 protected:
     juce::RangedAudioParameter* param;
     juce::String suffix;
 
+    void updateDisplayString();
+
 private:
+    // Resolved again whenever the effective look and feel changes. A slider added after its
+    // parent's setLookAndFeel never gets lookAndFeelChanged(), so paint checks it too.
+    juce::LookAndFeel* resolvedLookAndFeel{ nullptr };
+    LookAndFeel* customLookAndFeel{ nullptr };
+    void updateLookAndFeel();
+
+    juce::Image staticLayer;
+    float staticLayerScale{ 0.0f };
+    juce::Array<LabelPos> staticLayerLabels;
+    void renderStaticLayer(float scale);
+
+    juce::String cachedDisplayString;
+    int cachedDisplayStringWidth{ 0 };
+    bool displayStringIsStale{ true };
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RotarySliderWithLabels)
 };
 
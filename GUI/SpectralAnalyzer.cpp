@@ -13,22 +13,13 @@
 #include "../DSP/Constants.h"
 
 
-SpectralAnalyzerComponent::SpectralAnalyzerComponent(MBCompAudioProcessor& p) :
+SpectralAnalyzerComponent::SpectralAnalyzerComponent(MBCompAudioProcessor& p, RepaintScheduler& scheduler) :
     audioProcessor(p),
-    leftPathProducer(audioProcessor.leftChannelFifo),
-    rightPathProducer(audioProcessor.rightChannelFifo)
+    repaintScheduler(scheduler)
 {
-    const auto& params = audioProcessor.getParameters();
-    for (auto param : params)
-    {
-        param->addListener(this);
-    }
-    const auto& paramNames = Parameters::GetParams();
-
-    auto floatHelper = [&apvts = audioProcessor.apvts, &paramNames](auto& param, const auto& paramName)
+    auto floatHelper = [this](auto& param, Parameters::Names paramName)
         {
-            param = dynamic_cast<juce::AudioParameterFloat*>(apvts.getParameter(paramNames.at(paramName)));
-            jassert(param != nullptr);
+            param = Parameters::get<juce::AudioParameterFloat>(audioProcessor, paramName);
         };
 
     floatHelper(lowMidCrossoverParam, Parameters::Low_Mid_Crossover_Freq);
@@ -37,28 +28,73 @@ SpectralAnalyzerComponent::SpectralAnalyzerComponent(MBCompAudioProcessor& p) :
     floatHelper(midThresholdParam, Parameters::Threshold_Mid_Band);
     floatHelper(highThresholdParam, Parameters::Threshold_High_Band);
 
-    startTimerHz(60);
+    drawnParameters = { lowMidCrossoverParam, midHighCrossoverParam, lowThresholdParam, midThresholdParam, highThresholdParam };
+    for (auto* param : drawnParameters)
+    {
+        param->addListener(this);
+    }
+
+    setOpaque(true);
 }
 
 SpectralAnalyzerComponent::~SpectralAnalyzerComponent()
 {
-    const auto& params = audioProcessor.getParameters();
-    for (auto param : params)
+    if (leftPathProducer != nullptr)
+        analyzerService->removeClient(*this);
+
+    for (auto* param : drawnParameters)
     {
         param->removeListener(this);
     }
+
+    audioProcessor.setAnalyzerEnabled(false);
+}
+
+void SpectralAnalyzerComponent::toggleAnalysisEnablement(bool enabled)
+{
+    shouldShowFFTAnalysis = enabled;
+    audioProcessor.setAnalyzerEnabled(enabled);
+
+    if (enabled && leftPathProducer == nullptr)
+    {
+        leftPathProducer = std::make_unique<PathProducer>(audioProcessor.leftChannelFifo);
+        rightPathProducer = std::make_unique<PathProducer>(audioProcessor.rightChannelFifo);
+        leftPathProducer->setNegativeInfinity(negativeInfinity);
+        rightPathProducer->setNegativeInfinity(negativeInfinity);
+        analyzerService->addClient(*this);
+    }
+    else if (!enabled && leftPathProducer != nullptr)
+    {
+        analyzerService->removeClient(*this);
+        leftPathProducer.reset();
+        rightPathProducer.reset();
+    }
+
+    repaintScheduler.invalidate(*this, getAnalysisArea(getLocalBounds()));
 }
 
 
 void SpectralAnalyzerComponent::paint(juce::Graphics& g)
 {
     using namespace juce;
-    // (Our component is opaque, so we must completely fill the background with a solid colour)
-    g.fillAll(Colours::black);
 
-    auto bounds = drawModuleBackground(g, getLocalBounds());
+    MBCOMP_TRACE_SCOPE("SpectralAnalyzer::paint");
 
-    drawBackgroundGrid(g, bounds);
+#if MBCOMP_PROFILING
+    auto& monitor = audioProcessor.performanceMonitor;
+    const auto paintStartTicks = Time::getHighResolutionTicks();
+#endif
+
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!backgroundImage.isValid() || scale != backgroundScale)
+    {
+        renderBackground(scale);
+    }
+
+    g.drawImageTransformed(backgroundImage, AffineTransform::scale(1.0f / backgroundScale));
+
+    // the area drawModuleBackground leaves inside its border
+    auto bounds = getLocalBounds().reduced(3);
 
     if (shouldShowFFTAnalysis)
     {
@@ -66,8 +102,33 @@ void SpectralAnalyzerComponent::paint(juce::Graphics& g)
     }
 
     drawCrossovers(g, bounds);
-    drawTextLabels(g, bounds);
 
+#if MBCOMP_PROFILING
+    if (monitor.isEnabled())
+        monitor.addMessageThreadTime(monitor.paintMicros, paintStartTicks);
+#endif
+}
+
+void SpectralAnalyzerComponent::renderBackground(float scale)
+{
+    using namespace juce;
+
+    backgroundScale = scale;
+    backgroundImage = Image(Image::RGB,
+        jmax(1, roundToInt(getWidth() * scale)),
+        jmax(1, roundToInt(getHeight() * scale)),
+        true);
+
+    Graphics g(backgroundImage);
+    g.addTransform(AffineTransform::scale(scale));
+
+    // (Our component is opaque, so we must completely fill the background with a solid colour)
+    g.fillAll(Colours::black);
+
+    auto bounds = drawModuleBackground(g, getLocalBounds());
+
+    drawBackgroundGrid(g, bounds);
+    drawTextLabels(g, bounds);
 }
 
 std::vector<float> SpectralAnalyzerComponent::getFrequencies()
@@ -216,6 +277,9 @@ void SpectralAnalyzerComponent::drawTextLabels(juce::Graphics& g, juce::Rectangl
 
 void SpectralAnalyzerComponent::resized()
 {
+    // rebuilt on the next paint, at whatever scale that paint runs at
+    backgroundImage = juce::Image();
+
     juce::Rectangle<int> bounds = getLocalBounds();
     juce::Rectangle<float> fftBounds = getAnalysisArea(bounds).toFloat();
     float negInf = juce::jmap(bounds.toFloat().getBottom(),
@@ -223,8 +287,12 @@ void SpectralAnalyzerComponent::resized()
 
     DBG("Negatvie Infinity: " << negInf);
 
-    leftPathProducer.setNegativeInfinity(negInf);
-    rightPathProducer.setNegativeInfinity(negInf);
+    negativeInfinity = negInf;
+    if (leftPathProducer != nullptr)
+    {
+        leftPathProducer->setNegativeInfinity(negInf);
+        rightPathProducer->setNegativeInfinity(negInf);
+    }
 
 }
 
@@ -234,19 +302,64 @@ void SpectralAnalyzerComponent::parameterValueChanged(int parameterIndex, float
 }
 
 
-void SpectralAnalyzerComponent::timerCallback()
+void SpectralAnalyzerComponent::updateFrame()
 {
+    bool analysisChanged = parametersChanged.compareAndSetBool(false, true);
+
     if (shouldShowFFTAnalysis)
     {
-        juce::Rectangle<int> bounds = getLocalBounds();
-        juce::Rectangle<float> fftBounds = getAnalysisArea(bounds).toFloat();
-        fftBounds.setBottom(bounds.getBottom());
-        int sampleRate = audioProcessor.getSampleRate();
-
-        leftPathProducer.process(fftBounds, sampleRate);
-        rightPathProducer.process(fftBounds, sampleRate);
+        const bool newLeftPath = leftPathProducer->pullPath();
+        const bool newRightPath = rightPathProducer->pullPath();
+        analysisChanged = analysisChanged || newLeftPath || newRightPath;
+
+#if MBCOMP_PROFILING
+        // the analysis itself runs on the service's workers
+        auto& monitor = audioProcessor.performanceMonitor;
+        if (monitor.isEnabled())
+            monitor.analyzerMicros = analyzerService->getAverageJobMicros();
+#endif
     }
-    repaint();
+
+    if (analysisChanged)
+        repaintScheduler.invalidate(*this, getAnalysisArea(getLocalBounds()));
+}
+
+bool SpectralAnalyzerComponent::wantsAnalysis()
+{
+    return shouldShowFFTAnalysis && isShowing();
+}
+
+void SpectralAnalyzerComponent::prepareAnalysis()
+{
+    juce::Rectangle<int> bounds = getLocalBounds();
+    analysisBounds = getAnalysisArea(bounds).toFloat();
+    analysisBounds.setBottom(bounds.getBottom());
+    analysisSampleRate = audioProcessor.getSampleRate();
+}
+
+void SpectralAnalyzerComponent::runAnalysis()
+{
+    leftPathProducer->process(analysisBounds, analysisSampleRate);
+    rightPathProducer->process(analysisBounds, analysisSampleRate);
+}
+
+juce::Rectangle<int> SpectralAnalyzerComponent::getBandArea(size_t band)
+{
+    const auto area = getAnalysisArea(getLocalBounds());
+
+    auto mapX = [left = area.getX(), width = area.getWidth()](float frequency)
+        {
+            return left + juce::roundToInt(width * juce::mapFromLog10(frequency, MIN_FREQUENCY, MAX_FREQUENCY));
+        };
+
+    const int lowMidX = mapX(lowMidCrossoverParam->get());
+    const int midHighX = mapX(midHighCrossoverParam->get());
+
+    const int left = band == 0 ? area.getX() : band == 1 ? lowMidX : midHighX;
+    const int right = band == 0 ? lowMidX : band == 1 ? midHighX : area.getRight();
+
+    // one pixel either side covers the crossover lines drawn on the edges
+    return juce::Rectangle<int>::leftTopRightBottom(left - 1, area.getY(), right + 1, area.getBottom());
 }
 
 
@@ -276,14 +389,14 @@ void SpectralAnalyzerComponent::drawFFTAnalysis(juce::Graphics& g, juce::Rectang
     juce::Graphics::ScopedSaveState sss(g);
     g.reduceClipRegion(responseArea);
 
-    auto leftChannelFFTPath = leftPathProducer.getPath();
+    auto leftChannelFFTPath = leftPathProducer->getPath();
     leftChannelFFTPath.applyTransform(juce::AffineTransform().translation(responseArea.getX(), 0
     ));
 
     g.setColour(juce::Colour(97u, 18u, 167u)); //purple-
     g.strokePath(leftChannelFFTPath, juce::PathStrokeType(1.f));
 
-    auto rightChannelFFTPath = rightPathProducer.getPath();
+    auto rightChannelFFTPath = rightPathProducer->getPath();
     rightChannelFFTPath.applyTransform(juce::AffineTransform().translation(responseArea.getX(), 0
     ));
 
@@ -332,23 +445,28 @@ void SpectralAnalyzerComponent::drawCrossovers(juce::Graphics& g, juce::Rectangl
     g.drawHorizontalLine(mapY(highThresholdParam->get()), midHighX, right);
 }
 
-void SpectralAnalyzerComponent::update(const std::vector<float>& rmsValues)
+void SpectralAnalyzerComponent::updateMeters(const MeterFrame* frames, int numFrames)
 {
-    jassert(rmsValues.size() == 6);
+    // hold the deepest reduction of every frame since the last tick, so short transients still show
+    std::array<float, 3> maxGainReduction{};
 
-    enum
+    for (int i = 0; i < numFrames; ++i)
     {
-        lowBandIn,
-        lowBandOut,
-        midBandIn,
-        midBandOut,
-        highBandIn,
-        highBandOut
-    };
+        for (size_t band = 0; band < maxGainReduction.size(); ++band)
+            maxGainReduction[band] = juce::jmax(maxGainReduction[band], frames[i].bands[band].getMaxGainReductionDb());
+    }
 
-    lowBandGR = rmsValues[lowBandOut] - rmsValues[lowBandIn];
-    midBandGR = rmsValues[midBandOut] - rmsValues[midBandIn];
-    highBandGR = rmsValues[highBandOut] - rmsValues[highBandIn];
+    std::array<float*, 3> bandGR{ &lowBandGR, &midBandGR, &highBandGR };
 
-    repaint();
+    for (size_t band = 0; band < bandGR.size(); ++band)
+    {
+        const float newGR = -maxGainReduction[band];
+
+        // below a twentieth of a dB the rectangle does not move by a pixel
+        if (std::abs(newGR - *bandGR[band]) > 0.05f)
+        {
+            *bandGR[band] = newGR;
+            repaintScheduler.invalidate(*this, getBandArea(band));
+        }
+    }
 }
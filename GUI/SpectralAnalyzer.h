@@ -12,40 +12,52 @@
 #include <JuceHeader.h>
 #include "../PluginProcessor.h"
 #include "PathProducer.h"
+#include "RepaintScheduler.h"
+#include "AnalyzerService.h"
 
 
 struct SpectralAnalyzerComponent : juce::Component,
     juce::AudioProcessorParameter::Listener,
-    juce::Timer
+    AnalyzerService::Client
 {
-    SpectralAnalyzerComponent(MBCompAudioProcessor&);
+    SpectralAnalyzerComponent(MBCompAudioProcessor&, RepaintScheduler&);
     ~SpectralAnalyzerComponent();
 
     void parameterValueChanged(int parameterIndex, float newValue) override;
 
     void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override {}
 
-    void timerCallback() override;
+    /** Called once per editor frame: pulls the paths the analyzer service produced and invalidates what changed. */
+    void updateFrame();
+
+    bool wantsAnalysis() override;
+    void prepareAnalysis() override;
+    void runAnalysis() override;
 
     void paint(juce::Graphics& g) override;
     void resized() override;
 
-    void toggleAnalysisEnablement(bool enabled)
-    {
-        shouldShowFFTAnalysis = enabled;
-    }
+    /** The FFT chain is only allocated, and the processor only feeds it, while analysis is shown. */
+    void toggleAnalysisEnablement(bool enabled);
 
-    void update(const std::vector<float>& rmsValues);
+    /** Takes the meter frames published since the last editor tick. */
+    void updateMeters(const MeterFrame* frames, int numFrames);
 private:
     MBCompAudioProcessor& audioProcessor;
+    RepaintScheduler& repaintScheduler;
 
-    bool shouldShowFFTAnalysis = true;
+    bool shouldShowFFTAnalysis = false;
 
     juce::Atomic<bool> parametersChanged{ false };
 
     void drawBackgroundGrid(juce::Graphics& g, juce::Rectangle<int> bounds);
     void drawTextLabels(juce::Graphics& g, juce::Rectangle<int> bounds);
 
+    // module background, grid and labels, rendered at the display scale and reused every frame
+    juce::Image backgroundImage;
+    float backgroundScale{ 0.0f };
+    void renderBackground(float scale);
+
     std::vector<float> getFrequencies();
     std::vector<float> getGains();
     std::vector<float> getXs(const std::vector<float>& freqs, float left, float width);
@@ -54,7 +66,16 @@ private:
 
     juce::Rectangle<int> getAnalysisArea(juce::Rectangle<int> bounds);
 
-    PathProducer leftPathProducer, rightPathProducer;
+    // the column of the analysis area a band's gain reduction is drawn in
+    juce::Rectangle<int> getBandArea(size_t band);
+
+    juce::SharedResourcePointer<AnalyzerService> analyzerService;
+    std::unique_ptr<PathProducer> leftPathProducer, rightPathProducer;
+    float negativeInfinity{ NEGATIVE_INFINITY };
+
+    // written by prepareAnalysis() before the job is queued, read by the job
+    juce::Rectangle<float> analysisBounds;
+    double analysisSampleRate{ 44100.0 };
 
     void drawFFTAnalysis(juce::Graphics& g, juce::Rectangle<int> bounds);
 
@@ -67,6 +88,9 @@ private:
     juce::AudioParameterFloat* midThresholdParam{ nullptr };
     juce::AudioParameterFloat* highThresholdParam{ nullptr };
 
+    // the only parameters the analyzer draws, so the only ones it listens to
+    std::array<juce::AudioParameterFloat*, 5> drawnParameters{};
+
     float lowBandGR{ 0.0f };
     float midBandGR{ 0.0f };
     float highBandGR{ 0.0f };
@@ -8,34 +8,93 @@
 MBCompAudioProcessorEditor::MBCompAudioProcessorEditor(MBCompAudioProcessor& p)
     : AudioProcessorEditor(&p),
     audioProcessor(p),
-    analyzer(p),
+    analyzer(p, repaintScheduler),
     globalControls(audioProcessor.apvts),
     bandControls(audioProcessor.apvts)
 {
+    bypassParameters = getBypassParameters();
 
     controlBar.analyzerButton.onClick = [this]()
         {
             auto isOn = controlBar.analyzerButton.getToggleState();
             analyzer.toggleAnalysisEnablement(isOn);
         };
+    analyzer.toggleAnalysisEnablement(controlBar.analyzerButton.getToggleState());
 
     controlBar.globalBypassButton.onClick = [this]()
         {
             toggleGlobalBypassState();
         };
-    setLookAndFeel(&lnf);
+
+#if MBCOMP_PROFILING
+    controlBar.performanceButton.onClick = [this]()
+        {
+            performanceHud.setActive(controlBar.performanceButton.getToggleState());
+        };
+
+    controlBar.traceButton.onClick = [this]()
+        {
+            toggleTraceRecording(controlBar.traceButton.getToggleState());
+        };
+
+    controlBar.testSignalSelector.onChange = [this]()
+        {
+            auto signal = controlBar.testSignalSelector.getSelectedId() - 1;
+            audioProcessor.testSignal.setSignal(static_cast<TestSignal>(juce::jmax(0, signal)));
+        };
+    controlBar.testSignalSelector.setSelectedId(audioProcessor.testSignal.getSignal() + 1,
+        juce::NotificationType::dontSendNotification);
+#endif
+
+#if MBCOMP_BENCHMARKS
+    controlBar.benchmarkButton.onClick = [this]()
+        {
+            runInBackground(controlBar.benchmarkButton, "Benchmarks", []()
+                {
+                    // fail anything more than 10% slower than the baseline
+                    return Benchmarks::runAndCompare(juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+                        .getChildFile("MBComp Benchmarks"), 0.1);
+                });
+        };
+#endif
+
+#if MBCOMP_REGRESSION_HARNESS
+    controlBar.regressionButton.onClick = [this]()
+        {
+            runInBackground(controlBar.regressionButton, "Golden output", []()
+                {
+                    RegressionHarness::Options options;
+                    options.referenceDirectory = juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+                        .getChildFile("MBComp Golden");
+                    return RegressionHarness::run(options);
+                });
+        };
+#endif
+    setLookAndFeel(&lnf.get());
     addAndMakeVisible(controlBar);
     addAndMakeVisible(analyzer);
+    addAndMakeVisible(gainReductionScope);
     addAndMakeVisible(globalControls);
     addAndMakeVisible(bandControls);
 
-    setSize(600, 500);
+#if MBCOMP_PROFILING
+    // starts hidden, shown over the analyzer by the control bar button
+    addChildComponent(performanceHud);
+#endif
+
+    setSize(600, 590);
 
     startTimerHz(60);
 }
 
 MBCompAudioProcessorEditor::~MBCompAudioProcessorEditor()
 {
+#if MBCOMP_PROFILING
+    performanceHud.setActive(false);
+
+    // closing the editor is not a request to look at the trace, it is just kept
+    stopTraceRecording(false);
+#endif
     setLookAndFeel(nullptr);
 }
 
@@ -51,33 +110,105 @@ void MBCompAudioProcessorEditor::resized()
 
     controlBar.setBounds(bounds.removeFromTop(32));
     analyzer.setBounds(bounds.removeFromTop(225));
+    gainReductionScope.setBounds(bounds.removeFromTop(90));
     bandControls.setBounds(bounds.removeFromBottom(135));
     globalControls.setBounds(bounds);
 
+#if MBCOMP_PROFILING
+    performanceHud.setBounds(analyzer.getBounds().removeFromRight(150).reduced(6).withHeight(performanceHud.getPreferredHeight()));
+#endif
+
 }
 
 void MBCompAudioProcessorEditor::timerCallback()
 {
-    std::vector<float> rmsValues
+    int numFrames = 0;
+    while (numFrames < static_cast<int>(meterFrames.size())
+        && audioProcessor.meterFifo.pull(meterFrames[static_cast<size_t>(numFrames)]))
     {
-        audioProcessor.lowBandComp.getRmsInputLevelDb(),
-        audioProcessor.lowBandComp.getRmsOutputLevelDb(),
-        audioProcessor.midBandComp.getRmsInputLevelDb(),
-        audioProcessor.midBandComp.getRmsOutputLevelDb(),
-        audioProcessor.highBandComp.getRmsInputLevelDb(),
-        audioProcessor.highBandComp.getRmsOutputLevelDb()
-    };
-    analyzer.update(rmsValues);
+        ++numFrames;
+    }
+
+    if (numFrames > 0)
+    {
+        analyzer.updateMeters(meterFrames.data(), numFrames);
+        gainReductionScope.update(meterFrames.data(), numFrames);
+    }
+
+    analyzer.updateFrame();
     updateGlobalBypassButton();
 
+#if MBCOMP_PROFILING
+    performanceHud.update();
+
+    // the processor switches the test signal off by itself on re-prepare and state restore
+    const int testSignalId = audioProcessor.testSignal.getSignal() + 1;
+    if (controlBar.testSignalSelector.getSelectedId() != testSignalId)
+        controlBar.testSignalSelector.setSelectedId(testSignalId, juce::NotificationType::dontSendNotification);
+#endif
+
+    repaintScheduler.flush();
+
 }
 
+#if MBCOMP_PROFILING
+void MBCompAudioProcessorEditor::toggleTraceRecording(bool shouldRecord)
+{
+    auto& recorder = TraceRecorder::getInstance();
+
+    if (shouldRecord)
+    {
+        if (!recorder.isRecording())
+            recorder.startRecording();
+        return;
+    }
+
+    stopTraceRecording(true);
+}
+
+void MBCompAudioProcessorEditor::stopTraceRecording(bool revealTrace)
+{
+    auto& recorder = TraceRecorder::getInstance();
+
+    if (!recorder.isRecording())
+        return;
+
+    recorder.stopRecording();
+
+    auto traceFile = juce::File::getSpecialLocation(juce::File::userDocumentsDirectory)
+        .getChildFile("MBComp Traces")
+        .getNonexistentChildFile("trace", ".json");
+
+    if (traceFile.getParentDirectory().createDirectory().wasOk() && recorder.writeChromeTrace(traceFile) && revealTrace)
+        traceFile.revealToUser();
+}
+#endif
+
+#if MBCOMP_BENCHMARKS || MBCOMP_REGRESSION_HARNESS
+void MBCompAudioProcessorEditor::runInBackground(juce::Button& button, const juce::String& title,
+    std::function<juce::String()> task)
+{
+    button.setEnabled(false);
+
+    juce::Thread::launch([safeButton = juce::Component::SafePointer<juce::Button>(&button), title, task]()
+        {
+            const auto report = task();
+
+            juce::MessageManager::callAsync([safeButton, title, report]()
+                {
+                    if (safeButton != nullptr)
+                        safeButton->setEnabled(true);
+
+                    juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::InfoIcon, title, report);
+                });
+        });
+}
+#endif
+
 void MBCompAudioProcessorEditor::toggleGlobalBypassState()
 {
     bool isBypassEnabled = !controlBar.globalBypassButton.getToggleState();
 
-    std::array<juce::AudioParameterBool*, 3> bypParamsArray = getBypassParameters();
-
     auto bypassParamHelper = [](auto* param, bool isBypassed)
         {
             param->beginChangeGesture();
@@ -85,7 +216,7 @@ void MBCompAudioProcessorEditor::toggleGlobalBypassState()
             param->endChangeGesture();
         };
 
-    for (auto* param : bypParamsArray)
+    for (auto* param : bypassParameters)
     {
         bypassParamHelper(param, !isBypassEnabled);
     }
@@ -95,15 +226,9 @@ void MBCompAudioProcessorEditor::toggleGlobalBypassState()
 
 std::array<juce::AudioParameterBool*, 3> MBCompAudioProcessorEditor::getBypassParameters()
 {
-    const auto& parameters = Parameters::GetParams();
-    auto& apvts = audioProcessor.apvts;
-
-    auto boolHelper = [&apvts, &parameters](const auto& paramName)
+    auto boolHelper = [this](Parameters::Names paramName)
         {
-            juce::AudioParameterBool* param = dynamic_cast<juce::AudioParameterBool*>(apvts.getParameter(parameters.at(paramName)));
-            jassert(param != nullptr);
-
-            return param;
+            return Parameters::get<juce::AudioParameterBool>(audioProcessor, paramName);
         };
 
     juce::AudioParameterBool* lowBypassParam = boolHelper(Parameters::Names::Bypassed_Low_Band);
@@ -116,9 +241,7 @@ std::array<juce::AudioParameterBool*, 3> MBCompAudioProcessorEditor::getBypassPa
 
 void MBCompAudioProcessorEditor::updateGlobalBypassButton()
 {
-    std::array<juce::AudioParameterBool*, 3> bypassParams = getBypassParameters();
-
-    bool allBandsBypassed = std::all_of(bypassParams.begin(), bypassParams.end(),
+    bool allBandsBypassed = std::all_of(bypassParameters.begin(), bypassParameters.end(),
         [](juce::AudioParameterBool* param) {return param->get(); });
 
     controlBar.globalBypassButton.setToggleState(allBandsBypassed, juce::NotificationType::dontSendNotification);
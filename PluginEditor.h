@@ -13,6 +13,11 @@
 #include "GUI/GlobalControls.h"
 #include "GUI/SpectralAnalyzer.h"
 #include "GUI/ControlBar.h"
+#include "GUI/GainReductionScope.h"
+#include "GUI/RepaintScheduler.h"
+#include "GUI/PerformanceHud.h"
+#include "Service/Benchmarks.h"
+#include "Service/RegressionHarness.h"
 
 
 /**
@@ -30,7 +35,8 @@ public:
     void timerCallback() override;
 
 private:
-    LookAndFeel lnf;
+    // stateless, one for every editor in the process
+    juce::SharedResourcePointer<LookAndFeel> lnf;
 
     MBCompAudioProcessor& audioProcessor;
 
@@ -38,10 +44,34 @@ private:
     ControlBar controlBar;
     GlobalControls globalControls{ audioProcessor.apvts };
     CompressorBandControls bandControls{ audioProcessor.apvts };
-    SpectralAnalyzerComponent analyzer{ audioProcessor };
+    RepaintScheduler repaintScheduler;
+    SpectralAnalyzerComponent analyzer{ audioProcessor, repaintScheduler };
+    GainReductionScope gainReductionScope{ repaintScheduler };
+
+#if MBCOMP_PROFILING
+    PerformanceHud performanceHud{ audioProcessor, repaintScheduler };
+#endif
+
+    // everything pulled from the meter fifo in one tick
+    std::array<MeterFrame, METER_FIFO_CAPACITY> meterFrames;
 
     void toggleGlobalBypassState();
 
+#if MBCOMP_PROFILING
+    /** Turning it off writes the capture to a Chrome trace file and reveals it. */
+    void toggleTraceRecording(bool shouldRecord);
+
+    /** Saves a running capture; only a stop the user asked for opens the file's folder. */
+    void stopTraceRecording(bool revealTrace);
+#endif
+
+#if MBCOMP_BENCHMARKS || MBCOMP_REGRESSION_HARNESS
+    /** Runs a developer task on a background thread, disabling its button until the report is shown. */
+    void runInBackground(juce::Button& button, const juce::String& title, std::function<juce::String()> task);
+#endif
+
+    // looked up once in the constructor
+    std::array<juce::AudioParameterBool*, 3> bypassParameters{};
     std::array<juce::AudioParameterBool*, 3> getBypassParameters();
 
     void updateGlobalBypassButton();
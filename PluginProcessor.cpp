@@ -9,6 +9,12 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
+namespace
+{
+    // how often the message thread checks whether the engine latency moved
+    constexpr int latencyPollHz = 20;
+}
+
 //==============================================================================
 MBCompAudioProcessor::MBCompAudioProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -22,72 +28,99 @@ MBCompAudioProcessor::MBCompAudioProcessor()
     )
 #endif
 {
-    const auto& params = Parameters::GetParams();
-
-    auto floatHelper = [&apvts = this->apvts, &params](auto& param, const auto& paramName)
+    auto floatHelper = [this](auto& param, Parameters::Names paramName)
         {
-            param = dynamic_cast<juce::AudioParameterFloat*>(apvts.getParameter(params.at(paramName)));
-            jassert(param != nullptr);
+            param = Parameters::get<juce::AudioParameterFloat>(*this, paramName);
         };
 
-    auto choiceHelper = [&apvts = this->apvts, &params](auto& param, const auto& paramName)
+    auto choiceHelper = [this](auto& param, Parameters::Names paramName)
         {
-            param = dynamic_cast<juce::AudioParameterChoice*>(apvts.getParameter(params.at(paramName)));
-            jassert(param != nullptr);
+            param = Parameters::get<juce::AudioParameterChoice>(*this, paramName);
         };
 
-    auto boolHelper = [&apvts = this->apvts, &params](auto& param, const auto& paramName)
+    auto boolHelper = [this](auto& param, Parameters::Names paramName)
         {
-            param = dynamic_cast<juce::AudioParameterBool*>(apvts.getParameter(params.at(paramName)));
-            jassert(param != nullptr);
+            param = Parameters::get<juce::AudioParameterBool>(*this, paramName);
         };
 
 
-    floatHelper(lowBandComp.attack, Parameters::Names::Attack_Low_Band);
-    floatHelper(lowBandComp.release, Parameters::Names::Release_Low_Band);
-    floatHelper(lowBandComp.threshold, Parameters::Names::Threshold_Low_Band);
+    auto attachParameters = [&](auto& engine)
+        {
+            floatHelper(engine.lowBandComp.attack, Parameters::Names::Attack_Low_Band);
+            floatHelper(engine.lowBandComp.release, Parameters::Names::Release_Low_Band);
+            floatHelper(engine.lowBandComp.threshold, Parameters::Names::Threshold_Low_Band);
+
+            floatHelper(engine.midBandComp.attack, Parameters::Names::Attack_Mid_Band);
+            floatHelper(engine.midBandComp.release, Parameters::Names::Release_Mid_Band);
+            floatHelper(engine.midBandComp.threshold, Parameters::Names::Threshold_Mid_Band);
+
+            floatHelper(engine.highBandComp.attack, Parameters::Names::Attack_High_Band);
+            floatHelper(engine.highBandComp.release, Parameters::Names::Release_High_Band);
+            floatHelper(engine.highBandComp.threshold, Parameters::Names::Threshold_High_Band);
+
+            floatHelper(engine.lowMidCrossover, Parameters::Names::Low_Mid_Crossover_Freq);
+            floatHelper(engine.midHighCrossover, Parameters::Names::Mid_High_Crossover_Freq);
+
+            floatHelper(engine.inputGainParam, Parameters::Names::Input_Gain);
+            floatHelper(engine.outputGainParam, Parameters::Names::Output_Gain);
 
-    floatHelper(midBandComp.attack, Parameters::Names::Attack_Mid_Band);
-    floatHelper(midBandComp.release, Parameters::Names::Release_Mid_Band);
-    floatHelper(midBandComp.threshold, Parameters::Names::Threshold_Mid_Band);
+            choiceHelper(engine.lowBandComp.ratio, Parameters::Names::Ratio_Low_Band);
+            boolHelper(engine.lowBandComp.bypassed, Parameters::Names::Bypassed_Low_Band);
+            boolHelper(engine.lowBandComp.mute, Parameters::Names::Mute_Low_Band);
+            boolHelper(engine.lowBandComp.solo, Parameters::Names::Solo_Low_Band);
 
-    floatHelper(highBandComp.attack, Parameters::Names::Attack_High_Band);
-    floatHelper(highBandComp.release, Parameters::Names::Release_High_Band);
-    floatHelper(highBandComp.threshold, Parameters::Names::Threshold_High_Band);
+            choiceHelper(engine.midBandComp.ratio, Parameters::Names::Ratio_Mid_Band);
+            boolHelper(engine.midBandComp.bypassed, Parameters::Names::Bypassed_Mid_Band);
+            boolHelper(engine.midBandComp.mute, Parameters::Names::Mute_Mid_Band);
+            boolHelper(engine.midBandComp.solo, Parameters::Names::Solo_Mid_Band);
 
-    floatHelper(lowMidCrossover, Parameters::Names::Low_Mid_Crossover_Freq);
-    floatHelper(midHighCrossover, Parameters::Names::Mid_High_Crossover_Freq);
+            choiceHelper(engine.highBandComp.ratio, Parameters::Names::Ratio_High_Band);
+            boolHelper(engine.highBandComp.bypassed, Parameters::Names::Bypassed_High_Band);
+            boolHelper(engine.highBandComp.mute, Parameters::Names::Mute_High_Band);
+            boolHelper(engine.highBandComp.solo, Parameters::Names::Solo_High_Band);
 
-    floatHelper(inputGainParam, Parameters::Names::Input_Gain);
-    floatHelper(outputGainParam, Parameters::Names::Output_Gain);
+            choiceHelper(engine.crossoverMode, Parameters::Names::Crossover_Mode);
+            choiceHelper(engine.linearPhasePartitionSize, Parameters::Names::Linear_Phase_Partition_Size);
 
-    choiceHelper(lowBandComp.ratio, Parameters::Names::Ratio_Low_Band);
-    boolHelper(lowBandComp.bypassed, Parameters::Names::Bypassed_Low_Band);
-    boolHelper(lowBandComp.mute, Parameters::Names::Mute_Low_Band);
-    boolHelper(lowBandComp.solo, Parameters::Names::Solo_Low_Band);
+            boolHelper(engine.linkGroupParams[FrontGroup], Parameters::Names::Link_Front_Channels);
+            boolHelper(engine.linkGroupParams[SurroundGroup], Parameters::Names::Link_Surround_Channels);
+            boolHelper(engine.linkGroupParams[OtherGroup], Parameters::Names::Link_Other_Channels);
 
-    choiceHelper(midBandComp.ratio, Parameters::Names::Ratio_Mid_Band);
-    boolHelper(midBandComp.bypassed, Parameters::Names::Bypassed_Mid_Band);
-    boolHelper(midBandComp.mute, Parameters::Names::Mute_Mid_Band);
-    boolHelper(midBandComp.solo, Parameters::Names::Solo_Mid_Band);
+            choiceHelper(engine.lowBandComp.stereoMode, Parameters::Names::Stereo_Mode_Low_Band);
+            choiceHelper(engine.midBandComp.stereoMode, Parameters::Names::Stereo_Mode_Mid_Band);
+            choiceHelper(engine.highBandComp.stereoMode, Parameters::Names::Stereo_Mode_High_Band);
 
-    choiceHelper(highBandComp.ratio, Parameters::Names::Ratio_High_Band);
-    boolHelper(highBandComp.bypassed, Parameters::Names::Bypassed_High_Band);
-    boolHelper(highBandComp.mute, Parameters::Names::Mute_High_Band);
-    boolHelper(highBandComp.solo, Parameters::Names::Solo_High_Band);
+            floatHelper(engine.lowBandComp.makeupGain, Parameters::Names::Makeup_Gain_Low_Band);
+            boolHelper(engine.lowBandComp.autoMakeup, Parameters::Names::Auto_Makeup_Low_Band);
+            floatHelper(engine.lowBandComp.mix, Parameters::Names::Mix_Low_Band);
 
-    LPFilter1.setType(juce::dsp::LinkwitzRileyFilterType::lowpass);
-    HPFilter1.setType(juce::dsp::LinkwitzRileyFilterType::highpass);
-    APFilter2.setType(juce::dsp::LinkwitzRileyFilterType::allpass);
+            floatHelper(engine.midBandComp.makeupGain, Parameters::Names::Makeup_Gain_Mid_Band);
+            boolHelper(engine.midBandComp.autoMakeup, Parameters::Names::Auto_Makeup_Mid_Band);
+            floatHelper(engine.midBandComp.mix, Parameters::Names::Mix_Mid_Band);
+
+            floatHelper(engine.highBandComp.makeupGain, Parameters::Names::Makeup_Gain_High_Band);
+            boolHelper(engine.highBandComp.autoMakeup, Parameters::Names::Auto_Makeup_High_Band);
+            floatHelper(engine.highBandComp.mix, Parameters::Names::Mix_High_Band);
+
+            floatHelper(engine.mixParam, Parameters::Names::Mix);
+        };
 
-    LPFilter2.setType(juce::dsp::LinkwitzRileyFilterType::lowpass);
-    HPFilter2.setType(juce::dsp::LinkwitzRileyFilterType::highpass);
+    attachParameters(floatEngine);
+    attachParameters(doubleEngine);
 
+    floatEngine.meterFifo = &meterFifo;
+    doubleEngine.meterFifo = &meterFifo;
+    floatEngine.performanceMonitor = &performanceMonitor;
+    doubleEngine.performanceMonitor = &performanceMonitor;
 
+    presetBank.addFactoryPresets();
+
+    startTimerHz(latencyPollHz);
 }
 
 MBCompAudioProcessor::~MBCompAudioProcessor()
 {
+    stopTimer();
 }
 
 //==============================================================================
@@ -130,25 +163,27 @@ double MBCompAudioProcessor::getTailLengthSeconds() const
 
 int MBCompAudioProcessor::getNumPrograms()
 {
-    return 1;
+    return juce::jmax(1, presetBank.getNumPresets());
 }
 
 int MBCompAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return presetBank.getCurrentPreset();
 }
 
 void MBCompAudioProcessor::setCurrentProgram(int index)
 {
+    presetBank.recall(index);
 }
 
 const juce::String MBCompAudioProcessor::getProgramName(int index)
 {
-    return {};
+    return presetBank.getPresetName(index);
 }
 
 void MBCompAudioProcessor::changeProgramName(int index, const juce::String& newName)
 {
+    presetBank.setPresetName(index, newName);
 }
 
 //==============================================================================
@@ -159,37 +194,35 @@ void MBCompAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     spec.numChannels = getTotalNumOutputChannels();
     spec.sampleRate = sampleRate;
 
-    for (auto& comp : compressorArray)
-        comp.prepare(spec);
-
-    LPFilter1.prepare(spec);
-    HPFilter1.prepare(spec);
-    APFilter2.prepare(spec);
-    LPFilter2.prepare(spec);
-    HPFilter2.prepare(spec);
-
-    inputGain.prepare(spec);
-    outputGain.prepare(spec);
+    // Only the engine matching the host's precision is prepared, the other never runs.
+    const auto channelLayout = getChannelLayoutOfBus(false, 0);
 
-    inputGain.setRampDurationSeconds(0.05); // 50ms
-    outputGain.setRampDurationSeconds(0.05); // 50ms
-
-    for (auto& buffer : filterBufferArray)
+    if (isUsingDoublePrecision())
     {
-        buffer.setSize(spec.numChannels, samplesPerBlock);
+        doubleEngine.setChannelLayout(channelLayout);
+        doubleEngine.prepare(spec);
+        engineLatency.store(doubleEngine.getLatencySamples());
     }
+    else
+    {
+        floatEngine.setChannelLayout(channelLayout);
+        floatEngine.prepare(spec);
+        engineLatency.store(floatEngine.getLatencySamples());
+    }
+    setLatencySamples(engineLatency.load());
 
-    leftChannelFifo.prepare(samplesPerBlock);
-    rightChannelFifo.prepare(samplesPerBlock);
-
+    // The taps cut the stream into chunks of their own size whatever the host block, so once
+    // sized they are left alone and whatever the analyzer has buffered survives a re-prepare.
+    analyzerBlockSize = samplesPerBlock;
+    if (analyzerEnabled.load() && !leftChannelFifo.isPrepared())
+        prepareAnalyzerFifos();
 
-    osc.initialise([](float x) {return std::sin(x); });
-    osc.prepare(spec);
-    float oscFreq = getSampleRate() / ((2 << FFTOrder::order2048) - 1) * 50;
-    osc.setFrequency(oscFreq);
+    presetBank.prepare(sampleRate);
 
-    oscGain.prepare(spec);
-    oscGain.setGainDecibels(-12.0f);
+#if MBCOMP_PROFILING
+    testSignal.setSignal(TestSignalOff);
+    testSignal.prepare(sampleRate);
+#endif
 }
 
 void MBCompAudioProcessor::releaseResources()
@@ -197,6 +230,15 @@ void MBCompAudioProcessor::releaseResources()
 
 }
 
+void MBCompAudioProcessor::setNonRealtime(bool shouldBeNonRealtime) noexcept
+{
+    // every bounce starts its own count
+    if (shouldBeNonRealtime && !isNonRealtime())
+        renderThroughput.reset();
+
+    AudioProcessor::setNonRealtime(shouldBeNonRealtime);
+}
+
 #ifndef JucePlugin_PreferredChannelConfigurations
 bool MBCompAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 {
@@ -205,8 +247,9 @@ bool MBCompAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) co
     return true;
 #else
 
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-        && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // anything from mono up to MAX_CHANNELS wide, surround formats included
+    const auto& mainOutput = layouts.getMainOutputChannelSet();
+    if (mainOutput.isDisabled() || mainOutput.size() > MAX_CHANNELS)
         return false;
 
     // This checks if the input layout matches the output layout
@@ -221,55 +264,43 @@ bool MBCompAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) co
 #endif
 
 
-void MBCompAudioProcessor::updateState()
+void MBCompAudioProcessor::setAnalyzerEnabled(bool shouldBeEnabled)
 {
-    for (auto& comp : compressorArray)
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    if (!shouldBeEnabled)
     {
-        comp.updateCompressorSettings();
+        analyzerEnabled.store(false);
+        return;
     }
 
-    auto lowMidCutOffFreq = lowMidCrossover->get();
-    LPFilter1.setCutoffFrequency(lowMidCutOffFreq);
-    HPFilter1.setCutoffFrequency(lowMidCutOffFreq);
-
-    auto midHighCutoffFreq = midHighCrossover->get();
-    APFilter2.setCutoffFrequency(midHighCutoffFreq);
-    LPFilter2.setCutoffFrequency(midHighCutoffFreq);
-    HPFilter2.setCutoffFrequency(midHighCutoffFreq);
+    // the audio thread never touches the fifos while the flag is down, so they can be sized here
+    if (!analyzerEnabled.load() && analyzerBlockSize > 0 && !leftChannelFifo.isPrepared())
+        prepareAnalyzerFifos();
 
-    inputGain.setGainDecibels(inputGainParam->get());
-    outputGain.setGainDecibels(outputGainParam->get());
+    analyzerEnabled.store(true);
 }
 
-void MBCompAudioProcessor::splitBands(const juce::AudioBuffer<float>& inputBuffer)
+void MBCompAudioProcessor::prepareAnalyzerFifos()
 {
-    for (auto& filterBuffer : filterBufferArray)
-    {
-        filterBuffer = inputBuffer;
-    }
-
-    auto fb0Block = juce::dsp::AudioBlock<float>(filterBufferArray[0]);
-    auto fb1Block = juce::dsp::AudioBlock<float>(filterBufferArray[1]);
-    auto fb2Block = juce::dsp::AudioBlock<float>(filterBufferArray[2]);
-
-    auto fb0Ctx = juce::dsp::ProcessContextReplacing<float>(fb0Block);
-    auto fb1Ctx = juce::dsp::ProcessContextReplacing<float>(fb1Block);
-    auto fb2Ctx = juce::dsp::ProcessContextReplacing<float>(fb2Block);
-
-    LPFilter1.process(fb0Ctx);
-    APFilter2.process(fb0Ctx);
-
-    HPFilter1.process(fb1Ctx);
-    filterBufferArray[2] = filterBufferArray[1];
-    LPFilter2.process(fb1Ctx);
-
-    HPFilter2.process(fb2Ctx);
-
+    leftChannelFifo.prepare(analyzerBlockSize);
+    rightChannelFifo.prepare(analyzerBlockSize);
 }
 
+void MBCompAudioProcessor::timerCallback()
+{
+    // setLatencySamples tells the host through updateHostDisplay(withLatencyChanged)
+    const int latency = engineLatency.load();
+    if (latency != getLatencySamples())
+        setLatencySamples(latency);
+}
 
-void MBCompAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+template<typename SampleType>
+void MBCompAudioProcessor::processBlockImpl(juce::AudioBuffer<SampleType>& buffer, MultibandEngine<SampleType>& engine)
 {
+    MBCOMP_TRACE_SCOPE("processBlock");
+    MBCOMP_REALTIME_SECTION();
+
     juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -277,66 +308,60 @@ void MBCompAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    updateState();
-
-    if (false)
-    {
-        buffer.clear();
-        juce::dsp::AudioBlock<float> audioBlock(buffer);
-        juce::dsp::ProcessContextReplacing<float> context(audioBlock);
-        osc.process(context);
-
-        oscGain.setGainDecibels(JUCE_LIVE_CONSTANT(-12));
-        oscGain.process(context);
-    }
-
+#if MBCOMP_PROFILING
+    const bool profiling = performanceMonitor.isEnabled();
+    if (profiling)
+        performanceMonitor.beginBlock(buffer.getNumSamples(), getSampleRate());
+#endif
 
-    leftChannelFifo.update(buffer);
-    rightChannelFifo.update(buffer);
+    // Offline renders skip the analyzer taps and the meters, nobody is watching them.
+    // Everything that shapes the audio runs unchanged, so a bounce matches playback.
+    const bool offline = isNonRealtime();
+    if (offline)
+        renderThroughput.beginBlock();
 
-    applyGain(buffer, inputGain);
+    engine.setMeteringEnabled(!offline);
 
-    for (auto& filterBuffer : filterBufferArray)
-    {
-        filterBuffer = buffer;
-    }
-
-    splitBands(buffer);
+#if MBCOMP_PROFILING
+    // ahead of the analyzer tap, so both the analyzer and the engine see it
+    if (testSignal.isActive())
+        testSignal.process(buffer);
+#endif
 
-    for (size_t i = 0; i < filterBufferArray.size(); ++i)
+    if (!offline && analyzerEnabled.load() && leftChannelFifo.isPrepared())
     {
-        compressorArray[i].process(filterBufferArray[i]);
+        MBCOMP_PROFILE_STAGE(&performanceMonitor, InputTapStage);
+        leftChannelFifo.update(buffer);
+        rightChannelFifo.update(buffer);
     }
 
-    int numSamples = buffer.getNumSamples();
-    int numChannels = buffer.getNumChannels();
+    // the bank renders the block through the engine, splitting it where a preset switches
+    presetBank.process(buffer, engine);
 
-    buffer.clear();
-
-    auto addFilterBand = [nc = numChannels, ns = numSamples](auto& inputBuffer, const auto& source)
-        {
-            for (int i = 0; i < nc; ++i)
-            {
-                inputBuffer.addFrom(i, 0, source, i, 0, ns);
-            }
-        };
+    engineLatency.store(engine.getLatencySamples());
 
-    const bool bandIsSoloed = std::any_of(compressorArray.begin(), compressorArray.end(),
-        [](const auto& comp) { return comp.solo->get(); });
+    if (offline)
+        renderThroughput.endBlock(buffer.getNumSamples());
 
-    for (size_t i = 0; i < compressorArray.size(); ++i)
-    {
-        const auto& comp = compressorArray[i];
+#if MBCOMP_PROFILING
+    if (profiling)
+        performanceMonitor.endBlock();
+#endif
+}
 
-        if ((bandIsSoloed && comp.solo->get()) ||
-            (!bandIsSoloed && !comp.mute->get()))
-        {
-            addFilterBand(buffer, filterBufferArray[i]);
-        }
-    }
+void MBCompAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processBlockImpl(buffer, floatEngine);
+}
 
-    applyGain(buffer, outputGain);
+void MBCompAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processBlockImpl(buffer, doubleEngine);
+}
 
+bool MBCompAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
 }
 
 //==============================================================================
@@ -354,12 +379,34 @@ juce::AudioProcessorEditor* MBCompAudioProcessor::createEditor()
 //==============================================================================
 void MBCompAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    juce::MemoryOutputStream mos(destData, true);
-    apvts.state.writeToStream(mos);
+    ParameterState::write(*this, destData);
 }
 
 void MBCompAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    // the restored values win over any preset recall in flight or sent while the host loads
+    presetBank.stateRestored();
+
+#if MBCOMP_PROFILING
+    // a session must never come back up playing a test tone instead of its input
+    testSignal.setSignal(TestSignalOff);
+#endif
+
+    switch (ParameterState::read(*this, data, sizeInBytes))
+    {
+    case ParameterState::Restored:
+        return;
+
+    case ParameterState::Rejected:
+        // from a newer version or damaged, keep the current settings rather than guess
+        jassertfalse;
+        return;
+
+    case ParameterState::NotParameterState:
+        break;
+    }
+
+    // sessions saved before the binary format hold the whole value tree
     auto tree = juce::ValueTree::readFromData(data, sizeInBytes);
     if (tree.isValid())
     {
@@ -370,150 +417,7 @@ void MBCompAudioProcessor::setStateInformation(const void* data, int sizeInBytes
 
 juce::AudioProcessorValueTreeState::ParameterLayout MBCompAudioProcessor::createParameterLayout()
 {
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-    const auto& params = Parameters::GetParams();
-
-    auto gainRange = juce::NormalisableRange<float>{ -24.f, 18.f, 0.1f };
-    gainRange.setSkewForCentre(0.f);
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Input_Gain),
-        params.at(Parameters::Names::Input_Gain),
-        gainRange, 0));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Output_Gain),
-        params.at(Parameters::Names::Output_Gain),
-        gainRange, 0));
-
-    auto thresholdRange = juce::NormalisableRange<float>{ MIN_THRESHOLD, MAX_DECIBELS, 0.1f, 1 };
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Threshold_Low_Band),
-        params.at(Parameters::Names::Threshold_Low_Band),
-        thresholdRange, 0));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Threshold_Mid_Band),
-        params.at(Parameters::Names::Threshold_Mid_Band),
-        thresholdRange, 0));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Threshold_High_Band),
-        params.at(Parameters::Names::Threshold_High_Band),
-        thresholdRange, 0));
-
-    auto attackRange = juce::NormalisableRange<float>{ 0.1f, 100.f, 0.1f };
-    attackRange.setSkewForCentre(10.f);
-    auto releaseRange = juce::NormalisableRange<float>{ 5.f, 500.f, 0.1f, 1 };
-    releaseRange.setSkewForCentre(55.f);
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Attack_Low_Band),
-        params.at(Parameters::Names::Attack_Low_Band),
-        attackRange, 50
-    ));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Attack_Mid_Band),
-        params.at(Parameters::Names::Attack_Mid_Band),
-        attackRange, 50
-    ));
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Attack_High_Band),
-        params.at(Parameters::Names::Attack_High_Band),
-        attackRange, 50
-    ));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Release_Low_Band),
-        params.at(Parameters::Names::Release_Low_Band),
-        releaseRange, 250
-    ));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Release_Mid_Band),
-        params.at(Parameters::Names::Release_Mid_Band),
-        releaseRange, 250
-    ));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Release_High_Band),
-        params.at(Parameters::Names::Release_High_Band),
-        releaseRange, 250
-    ));
-
-    auto ratioChoices = std::vector<double>{ 1, 1.5, 2, 3, 4, 7, 10, 15, 20, 50 };
-
-    juce::StringArray ratioChoicesString;
-    for (auto choice : ratioChoices)
-    {
-        ratioChoicesString.add(juce::String(choice, 1));
-    }
-
-    layout.add(std::make_unique<juce::AudioParameterChoice>(
-        params.at(Parameters::Names::Ratio_Low_Band),
-        params.at(Parameters::Names::Ratio_Low_Band),
-        ratioChoicesString, 3));
-
-    layout.add(std::make_unique<juce::AudioParameterChoice>(
-        params.at(Parameters::Names::Ratio_Mid_Band),
-        params.at(Parameters::Names::Ratio_Mid_Band),
-        ratioChoicesString, 3));
-
-    layout.add(std::make_unique<juce::AudioParameterChoice>(
-        params.at(Parameters::Names::Ratio_High_Band),
-        params.at(Parameters::Names::Ratio_High_Band),
-        ratioChoicesString, 3));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Bypassed_Low_Band),
-        params.at(Parameters::Names::Bypassed_Low_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Bypassed_Mid_Band),
-        params.at(Parameters::Names::Bypassed_Mid_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Bypassed_High_Band),
-        params.at(Parameters::Names::Bypassed_High_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Mute_Low_Band),
-        params.at(Parameters::Names::Mute_Low_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Mute_Mid_Band),
-        params.at(Parameters::Names::Mute_Mid_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Mute_High_Band),
-        params.at(Parameters::Names::Mute_High_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Solo_Low_Band),
-        params.at(Parameters::Names::Solo_Low_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Solo_Mid_Band),
-        params.at(Parameters::Names::Solo_Mid_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        params.at(Parameters::Names::Solo_High_Band),
-        params.at(Parameters::Names::Solo_High_Band), false));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Low_Mid_Crossover_Freq),
-        params.at(Parameters::Names::Low_Mid_Crossover_Freq),
-        juce::NormalisableRange<float>(MIN_FREQUENCY, 999, 1, 1), 450));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        params.at(Parameters::Names::Mid_High_Crossover_Freq),
-        params.at(Parameters::Names::Mid_High_Crossover_Freq),
-        juce::NormalisableRange<float>(1000, MAX_FREQUENCY, 1, 1), 2000));
-
-    return layout;
-
+    return Parameters::createParameterLayout();
 }
 
 //==============================================================================
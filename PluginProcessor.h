@@ -14,9 +14,17 @@
 #include "DSP/Constants.h"               
 #include "DSP/FIFO.h"                      
 #include "DSP/SingleChannelSampleFIFO.h"
+#include "DSP/MultibandEngine.h"
+#include "DSP/PerformanceMonitor.h"
+#include "DSP/RealtimeSafety.h"
+#include "DSP/RenderThroughput.h"
+#include "DSP/TestSignalGenerator.h"
+#include "Service/ParameterState.h"
+#include "Service/PresetBank.h"
 
 
-class MBCompAudioProcessor : public juce::AudioProcessor
+class MBCompAudioProcessor : public juce::AudioProcessor,
+    private juce::Timer
 {
 public:
     //==============================================================================
@@ -26,12 +34,15 @@ public:
     //==============================================================================
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
+    void setNonRealtime(bool shouldBeNonRealtime) noexcept override;
 
 #ifndef JucePlugin_PreferredChannelConfigurations
     bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
 #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -63,43 +74,42 @@ public:
     SingleChannelSampleFifo<juce::AudioBuffer<float>> leftChannelFifo{ Channel::Left };
     SingleChannelSampleFifo<juce::AudioBuffer<float>> rightChannelFifo{ Channel::Right };
 
-    std::array<CompressorBand, 3> compressorArray;
+    /** Message thread. The analyzer fifos are only allocated and fed while an editor shows the analyzer. */
+    void setAnalyzerEnabled(bool shouldBeEnabled);
 
-    CompressorBand& lowBandComp = compressorArray[0];
-    CompressorBand& midBandComp = compressorArray[1];
-    CompressorBand& highBandComp = compressorArray[2];
+    Fifo<MeterFrame, METER_FIFO_CAPACITY> meterFifo;
 
+    PerformanceMonitor performanceMonitor;
 
-private:
-    //==============================================================================
+    // how fast the current or last offline bounce ran
+    RenderThroughput renderThroughput;
+
+#if MBCOMP_PROFILING
+    // replaces the input for profiling and calibration, off unless selected and never
+    // carried across a re-prepare or a state restore
+    TestSignalGenerator testSignal;
+#endif
 
-    juce::dsp::LinkwitzRileyFilter<float>
-        LPFilter1, APFilter2,
-        HPFilter1, LPFilter2,
-        HPFilter2;
+    PresetBank presetBank{ *this };
 
-    juce::AudioParameterFloat* lowMidCrossover{ nullptr };
-    juce::AudioParameterFloat* midHighCrossover{ nullptr };
+private:
+    //==============================================================================
 
-    std::array<juce::AudioBuffer<float>, 3> filterBufferArray;
+    MultibandEngine<float> floatEngine;
+    MultibandEngine<double> doubleEngine;
 
-    juce::dsp::Gain<float> inputGain, outputGain;
-    juce::AudioParameterFloat* inputGainParam{ nullptr };
-    juce::AudioParameterFloat* outputGainParam{ nullptr };
+    std::atomic<bool> analyzerEnabled{ false };
+    int analyzerBlockSize{ 0 };
 
-    template<typename T, typename U>
-    void applyGain(T& buffer, U& gain)
-    {
-        auto block = juce::dsp::AudioBlock<float>(buffer);
-        auto ctx = juce::dsp::ProcessContextReplacing<float>(block);
-        gain.process(ctx);
-    }
+    void prepareAnalyzerFifos();
 
-    void updateState();
-    void splitBands(const juce::AudioBuffer<float>& inputBuffer);
+    template<typename SampleType>
+    void processBlockImpl(juce::AudioBuffer<SampleType>& buffer, MultibandEngine<SampleType>& engine);
 
-    juce::dsp::Oscillator<float> osc;
-    juce::dsp::Gain<float> oscGain;
+    // The audio thread only stores the engine latency; a message thread timer polls it and
+    // tells the host, so nothing on the audio thread posts a message or takes a lock.
+    std::atomic<int> engineLatency{ 0 };
+    void timerCallback() override;
 
     //================================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MBCompAudioProcessor)
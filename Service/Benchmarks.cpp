@@ -0,0 +1,413 @@
+/*
+  ==============================================================================
+
+    Benchmarks.cpp
+    Created: 19 Oct 2026 7:40:18pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "Benchmarks.h"
+
+#if MBCOMP_BENCHMARKS
+
+#include <algorithm>
+#include "../DSP/CrossoverKernel.h"
+#include "../DSP/CompressorKernel.h"
+#include "../DSP/LinearPhaseCrossover.h"
+#include "../DSP/SingleChannelSampleFIFO.h"
+#include "../DSP/FIFO.h"
+#include "../DSP/Metering.h"
+#include "../GUI/FFTDataGenerator.h"
+#include "../GUI/AnalyzerPathGenerator.h"
+#include "../GUI/PathProducer.h"
+#include "../PluginProcessor.h"
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr double sampleRate = 48000.0;
+        constexpr double targetBatchSeconds = 0.005;
+        constexpr int numBatches = 7;
+        constexpr int numWarmupIterations = 8;
+
+        double ticksToSeconds(juce::int64 ticks)
+        {
+            return static_cast<double>(ticks) / static_cast<double>(juce::Time::getHighResolutionTicksPerSecond());
+        }
+
+        template<typename Fn>
+        double timeBatch(Fn& fn, int iterations)
+        {
+            const auto start = juce::Time::getHighResolutionTicks();
+            for (int i = 0; i < iterations; ++i)
+                fn();
+            return ticksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        }
+
+        template<typename Fn>
+        Result measure(const juce::String& name, Fn&& fn)
+        {
+            for (int i = 0; i < numWarmupIterations; ++i)
+                fn();
+
+            // double the batch until it is long enough for the clock to resolve
+            int iterations = 1;
+            while (timeBatch(fn, iterations) < targetBatchSeconds && iterations < (1 << 20))
+                iterations *= 2;
+
+            std::array<double, numBatches> batchSeconds;
+            for (auto& seconds : batchSeconds)
+                seconds = timeBatch(fn, iterations);
+
+            auto median = batchSeconds.begin() + numBatches / 2;
+            std::nth_element(batchSeconds.begin(), median, batchSeconds.end());
+
+            return { name, *median * 1.0e9 / iterations, iterations };
+        }
+
+        template<typename SampleType>
+        void fillWithNoise(juce::AudioBuffer<SampleType>& buffer)
+        {
+            juce::Random random(0x5eed);
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+                for (int i = 0; i < buffer.getNumSamples(); ++i)
+                    buffer.setSample(ch, i, static_cast<SampleType>(random.nextFloat() * 2.0f - 1.0f));
+        }
+
+        template<typename SampleType>
+        const char* precisionName() { return std::is_same_v<SampleType, float> ? "float" : "double"; }
+
+        juce::dsp::ProcessSpec makeSpec(int numChannels, int blockSize)
+        {
+            return { sampleRate, static_cast<juce::uint32>(blockSize), static_cast<juce::uint32>(numChannels) };
+        }
+
+        //==============================================================================
+        template<typename SampleType>
+        void addCrossoverCases(std::vector<Result>& results)
+        {
+            for (int numChannels : { 2, 8 })
+            {
+                for (int blockSize : { 64, 512 })
+                {
+                    CrossoverKernel<SampleType> crossover;
+                    crossover.prepare(makeSpec(numChannels, blockSize));
+                    crossover.setCrossoverFrequencies(400.0f, 2000.0f);
+
+                    juce::AudioBuffer<SampleType> input(numChannels, blockSize);
+                    fillWithNoise(input);
+
+                    std::array<juce::AudioBuffer<SampleType>, 3> bands;
+                    for (auto& band : bands)
+                        band.setSize(numChannels, blockSize);
+
+                    results.push_back(measure(juce::String("splitBands/iir/") + precisionName<SampleType>()
+                        + "/" + juce::String(numChannels) + "ch/" + juce::String(blockSize),
+                        [&] { crossover.process(input, bands); }));
+                }
+            }
+        }
+
+        // At the engine's sub-block size most calls fall between partition boundaries,
+        // so the per call cost here shows how evenly the partition work is spread.
+        void addLinearPhaseCases(std::vector<Result>& results)
+        {
+            constexpr int numChannels = 2;
+
+            for (int blockSize : { ENGINE_SUB_BLOCK_SIZE, 512 })
+            {
+                for (int index = 0; index < NUM_PARTITION_SIZES; ++index)
+                {
+                    const int partitionSize = LinearPhaseCrossover::getPartitionSizeForIndex(index);
+
+                    LinearPhaseCrossover crossover;
+                    crossover.prepare(makeSpec(numChannels, blockSize), partitionSize, 400.0f, 2000.0f);
+
+                    juce::AudioBuffer<float> input(numChannels, blockSize);
+                    fillWithNoise(input);
+
+                    std::array<juce::AudioBuffer<float>, 3> bands;
+                    for (auto& band : bands)
+                        band.setSize(numChannels, blockSize);
+
+                    results.push_back(measure("splitBands/linear/float/2ch/" + juce::String(blockSize)
+                        + "/partition" + juce::String(partitionSize),
+                        [&] { crossover.process(input, bands); }));
+                }
+            }
+        }
+
+        // the kernel is all of CompressorBand::process, metering included
+        template<typename SampleType>
+        void addCompressorCases(std::vector<Result>& results)
+        {
+            constexpr int blockSize = 512;
+
+            for (int numChannels : { 2, 8 })
+            {
+                for (bool linked : { false, true })
+                {
+                    CompressorKernel<SampleType> compressor;
+                    compressor.prepare(makeSpec(numChannels, blockSize));
+                    compressor.setAttack(SampleType(5));
+                    compressor.setRelease(SampleType(100));
+                    compressor.setThreshold(SampleType(-20));
+                    compressor.setRatio(SampleType(4));
+                    compressor.setMix(SampleType(1));
+
+                    std::array<int, MAX_CHANNELS> groups;
+                    groups.fill(linked ? 0 : -1);
+                    compressor.setLinkGroups(groups.data());
+
+                    juce::AudioBuffer<SampleType> source(numChannels, blockSize), buffer(numChannels, blockSize);
+                    fillWithNoise(source);
+
+                    results.push_back(measure(juce::String("CompressorBand::process/") + precisionName<SampleType>()
+                        + "/" + juce::String(numChannels) + "ch/" + (linked ? "linked" : "unlinked"),
+                        [&]
+                        {
+                            buffer.makeCopyOf(source, true);
+                            compressor.process(buffer);
+                        }));
+                }
+            }
+        }
+
+        template<typename SampleType>
+        void addSampleFifoCases(std::vector<Result>& results)
+        {
+            for (int blockSize : { 64, 512 })
+            {
+                SingleChannelSampleFifo<juce::AudioBuffer<float>> fifo{ Channel::Left };
+                fifo.prepare(blockSize);
+
+                juce::AudioBuffer<SampleType> input(2, blockSize);
+                fillWithNoise(input);
+
+                juce::AudioBuffer<float> output;
+
+                results.push_back(measure(juce::String("SingleChannelSampleFifo::update/") + precisionName<SampleType>()
+                    + "/" + juce::String(blockSize),
+                    [&]
+                    {
+                        fifo.update(input);
+                        while (fifo.getAudioBuffer(output)) {}
+                    }));
+            }
+        }
+
+        template<typename T>
+        void addFifoCase(std::vector<Result>& results, const juce::String& typeName, Fifo<T>& fifo, const T& item)
+        {
+            T output = item;
+
+            results.push_back(measure("Fifo::push+pull/" + typeName,
+                [&]
+                {
+                    fifo.push(item);
+                    fifo.pull(output);
+                }));
+        }
+
+        void addFifoCases(std::vector<Result>& results)
+        {
+            {
+                Fifo<juce::AudioBuffer<float>> fifo;
+                fifo.prepare(1, 2048);
+                juce::AudioBuffer<float> item(1, 2048);
+                fillWithNoise(item);
+                addFifoCase(results, "AudioBuffer<float>/2048", fifo, item);
+            }
+            {
+                Fifo<std::vector<float>> fifo;
+                fifo.prepare(static_cast<size_t>(4096));
+                addFifoCase(results, "vector<float>/4096", fifo, std::vector<float>(4096, 0.5f));
+            }
+            {
+                Fifo<juce::Path> fifo;
+                juce::Path item;
+                item.startNewSubPath(0.0f, 0.0f);
+                for (int x = 1; x < 600; ++x)
+                    item.lineTo(static_cast<float>(x), static_cast<float>(x % 37));
+                addFifoCase(results, "Path/600", fifo, item);
+            }
+            {
+                Fifo<MeterFrame, METER_FIFO_CAPACITY> fifo;
+                MeterFrame item, output;
+                results.push_back(measure("Fifo::push+pull/MeterFrame",
+                    [&]
+                    {
+                        fifo.push(item);
+                        fifo.pull(output);
+                    }));
+            }
+        }
+
+        void addFFTCases(std::vector<Result>& results)
+        {
+            for (auto order : { FFTOrder::order2048, FFTOrder::order4096, FFTOrder::order8192 })
+            {
+                FFTDataGenerator generator;
+                generator.changeOrder(order);
+
+                juce::AudioBuffer<float> input(1, generator.getFFTSize());
+                fillWithNoise(input);
+
+                std::vector<float> fftData;
+
+                results.push_back(measure("FFTDataGenerator::produceFFTDataForRendering/" + juce::String(generator.getFFTSize()),
+                    [&]
+                    {
+                        generator.produceFFTDataForRendering(input, NEGATIVE_INFINITY);
+                        while (generator.getFFTData(fftData)) {}
+                    }));
+            }
+        }
+
+        void addPathCases(std::vector<Result>& results)
+        {
+            FFTDataGenerator generator;
+            juce::AudioBuffer<float> input(1, generator.getFFTSize());
+            fillWithNoise(input);
+
+            std::vector<float> fftData;
+            generator.produceFFTDataForRendering(input, NEGATIVE_INFINITY);
+            generator.getFFTData(fftData);
+
+            const int fftSize = generator.getFFTSize();
+            const float binWidth = static_cast<float>(sampleRate / fftSize);
+
+            for (int width : { 300, 600, 1200 })
+            {
+                AnalyzerPathGenerator pathGenerator;
+                juce::Path path;
+                const juce::Rectangle<float> bounds(0.0f, 0.0f, static_cast<float>(width), 200.0f);
+
+                results.push_back(measure("AnalyzerPathGenerator::generatePath/" + juce::String(width),
+                    [&]
+                    {
+                        pathGenerator.generatePath(fftData, bounds, fftSize, binWidth, NEGATIVE_INFINITY);
+                        while (pathGenerator.getPath(path)) {}
+                    }));
+            }
+        }
+
+        // what every instance costs a session load, and what opening an editor with the analyzer on adds
+        void addStartupCases(std::vector<Result>& results)
+        {
+            results.push_back(measure("MBCompAudioProcessor::construct", [] { MBCompAudioProcessor processor; }));
+
+            results.push_back(measure("MBCompAudioProcessor::construct+prepare/48k/512", []
+                {
+                    MBCompAudioProcessor processor;
+                    processor.setRateAndBufferSizeDetails(sampleRate, 512);
+                    processor.prepareToPlay(sampleRate, 512);
+                }));
+
+            SingleChannelSampleFifo<juce::AudioBuffer<float>> fifo{ Channel::Left };
+            fifo.prepare(512);
+
+            results.push_back(measure("PathProducer::construct/stereo", [&]
+                {
+                    PathProducer left(fifo), right(fifo);
+                }));
+        }
+    }
+
+    //==============================================================================
+    std::vector<Result> runAll()
+    {
+        std::vector<Result> results;
+
+        addCrossoverCases<float>(results);
+        addCrossoverCases<double>(results);
+        addLinearPhaseCases(results);
+        addCompressorCases<float>(results);
+        addCompressorCases<double>(results);
+        addSampleFifoCases<float>(results);
+        addSampleFifoCases<double>(results);
+        addFifoCases(results);
+        addFFTCases(results);
+        addPathCases(results);
+        addStartupCases(results);
+
+        return results;
+    }
+
+    bool writeJson(const std::vector<Result>& results, const juce::File& file)
+    {
+        juce::Array<juce::var> cases;
+
+        for (const auto& result : results)
+        {
+            auto* object = new juce::DynamicObject();
+            object->setProperty("name", result.name);
+            object->setProperty("ns_per_iteration", result.nanosPerIteration);
+            object->setProperty("iterations_per_batch", result.iterationsPerBatch);
+            cases.add(juce::var(object));
+        }
+
+        auto* root = new juce::DynamicObject();
+        root->setProperty("benchmarks", cases);
+
+        return file.replaceWithText(juce::JSON::toString(juce::var(root)));
+    }
+
+    juce::StringArray findRegressions(const std::vector<Result>& results, const juce::File& baselineFile, double threshold)
+    {
+        juce::StringArray regressions;
+
+        const auto baseline = juce::JSON::parse(baselineFile);
+        const auto* baselineCases = baseline.getProperty("benchmarks", {}).getArray();
+        if (baselineCases == nullptr)
+            return regressions;
+
+        for (const auto& result : results)
+        {
+            for (const auto& baselineCase : *baselineCases)
+            {
+                if (baselineCase.getProperty("name", {}).toString() != result.name)
+                    continue;
+
+                const double baselineNanos = baselineCase.getProperty("ns_per_iteration", 0.0);
+                if (baselineNanos > 0.0 && result.nanosPerIteration > baselineNanos * (1.0 + threshold))
+                {
+                    regressions.add(result.name + ": " + juce::String(baselineNanos, 1) + " ns -> "
+                        + juce::String(result.nanosPerIteration, 1) + " ns");
+                }
+                break;
+            }
+        }
+
+        return regressions;
+    }
+
+    juce::String runAndCompare(const juce::File& directory, double threshold)
+    {
+        const auto results = runAll();
+
+        directory.createDirectory();
+        const auto resultsFile = directory.getChildFile("results.json");
+        const auto baselineFile = directory.getChildFile("baseline.json");
+
+        if (!writeJson(results, resultsFile))
+            return "Could not write " + resultsFile.getFullPathName();
+
+        juce::String summary;
+        summary << static_cast<int>(results.size()) << " cases written to " << resultsFile.getFullPathName() << "\n";
+
+        if (!baselineFile.existsAsFile())
+            return summary + "No baseline.json yet, copy results.json to baseline.json to compare future runs.";
+
+        const auto regressions = findRegressions(results, baselineFile, threshold);
+        if (regressions.isEmpty())
+            return summary + "No case regressed by more than " + juce::String(threshold * 100.0, 0) + "%.";
+
+        return summary + juce::String(regressions.size()) + " regressions:\n" + regressions.joinIntoString("\n");
+    }
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+  ==============================================================================
+
+    Benchmarks.h
+    Created: 19 Oct 2026 7:40:18pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <vector>
+#include "../DSP/Constants.h"
+
+#if MBCOMP_BENCHMARKS
+
+/*
+    Micro benchmarks for every DSP and analyzer stage, run in process so they
+    measure exactly the code the plugin ships. Each case is timed in batches
+    sized to take a few milliseconds, the reported figure is the median batch.
+
+    Results are written as JSON; a previous results file can be kept as the
+    baseline and any case slower than it by more than the threshold is reported
+    as a regression.
+*/
+namespace Benchmarks
+{
+    struct Result
+    {
+        juce::String name;
+        double nanosPerIteration{ 0.0 };
+        int iterationsPerBatch{ 0 };
+    };
+
+    std::vector<Result> runAll();
+
+    bool writeJson(const std::vector<Result>& results, const juce::File& file);
+
+    /** One line per case more than `threshold` (0.1 = 10%) slower than the baseline file. */
+    juce::StringArray findRegressions(const std::vector<Result>& results, const juce::File& baselineFile, double threshold);
+
+    /** Runs everything, writes results.json next to baseline.json and returns a readable summary. */
+    juce::String runAndCompare(const juce::File& directory, double threshold);
+}
+
+#endif
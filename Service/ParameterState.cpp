@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    ParameterState.cpp
+    Created: 19 Oct 2026 9:31:22pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "ParameterState.h"
+
+namespace ParameterState
+{
+    namespace
+    {
+        constexpr int headerSize = 8;
+        constexpr int entrySize = 8;
+
+        juce::RangedAudioParameter* asRanged(juce::AudioProcessorParameter* param)
+        {
+            auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(param);
+            jassert(ranged != nullptr); // every parameter in this plugin comes from the apvts layout
+            return ranged;
+        }
+    }
+
+    juce::uint32 hashParameterID(const juce::String& parameterID)
+    {
+        juce::uint32 hash = 2166136261u;
+        for (auto* c = parameterID.toRawUTF8(); *c != 0; ++c)
+        {
+            hash ^= static_cast<juce::uint8>(*c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    Snapshot capture(const juce::AudioProcessor& processor, const juce::String& name)
+    {
+        Snapshot snapshot;
+        snapshot.name = name;
+
+        const auto& parameters = processor.getParameters();
+        snapshot.values.reserve(static_cast<size_t>(parameters.size()));
+
+        for (auto* param : parameters)
+            snapshot.values.push_back(param->getValue());
+
+        return snapshot;
+    }
+
+    void write(const juce::AudioProcessor& processor, juce::MemoryBlock& destData)
+    {
+        const auto& parameters = processor.getParameters();
+
+        juce::MemoryOutputStream stream(destData, true);
+        stream.preallocate(static_cast<size_t>(headerSize + entrySize * parameters.size()));
+
+        stream.writeInt(static_cast<int>(magic));
+        stream.writeShort(static_cast<short>(currentVersion));
+        stream.writeShort(static_cast<short>(parameters.size()));
+
+        for (auto* param : parameters)
+        {
+            auto* ranged = asRanged(param);
+            stream.writeInt(static_cast<int>(hashParameterID(ranged->getParameterID())));
+            stream.writeFloat(ranged->convertFrom0to1(ranged->getValue()));
+        }
+    }
+
+    ReadResult read(juce::AudioProcessor& processor, const void* data, int sizeInBytes)
+    {
+        if (sizeInBytes < 4)
+            return NotParameterState;
+
+        juce::MemoryInputStream stream(data, static_cast<size_t>(sizeInBytes), false);
+
+        if (static_cast<juce::uint32>(stream.readInt()) != magic)
+            return NotParameterState;
+
+        // from here on the data is ours, so anything unreadable is an error rather than another format
+        if (sizeInBytes < headerSize)
+            return Rejected;
+
+        const int version = static_cast<juce::uint16>(stream.readShort());
+        const int count = static_cast<juce::uint16>(stream.readShort());
+
+        if (version < 1 || version > currentVersion)
+            return Rejected;
+
+        if (sizeInBytes < headerSize + count * entrySize)
+            return Rejected;
+
+        const auto& parameters = processor.getParameters();
+
+        std::vector<juce::uint32> hashes;
+        hashes.reserve(static_cast<size_t>(parameters.size()));
+        for (auto* param : parameters)
+            hashes.push_back(hashParameterID(asRanged(param)->getParameterID()));
+
+        // anything the data does not mention goes back to its default
+        std::vector<float> values;
+        values.reserve(static_cast<size_t>(parameters.size()));
+        for (auto* param : parameters)
+            values.push_back(param->getDefaultValue());
+
+        for (int i = 0; i < count; ++i)
+        {
+            const auto hash = static_cast<juce::uint32>(stream.readInt());
+            const float value = stream.readFloat();
+
+            const auto found = std::find(hashes.begin(), hashes.end(), hash);
+            if (found == hashes.end())
+                continue;
+
+            auto* ranged = asRanged(parameters[static_cast<int>(std::distance(hashes.begin(), found))]);
+            values[static_cast<size_t>(std::distance(hashes.begin(), found))] = ranged->convertTo0to1(value);
+        }
+
+        // set directly: no tree rebuild, and only the listeners of parameters that actually changed hear about it
+        for (int i = 0; i < parameters.size(); ++i)
+        {
+            auto* param = parameters[i];
+            if (param->getValue() != values[static_cast<size_t>(i)])
+                param->setValueNotifyingHost(values[static_cast<size_t>(i)]);
+        }
+
+        return Restored;
+    }
+}
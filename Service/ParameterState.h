@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    ParameterState.h
+    Created: 19 Oct 2026 9:31:22pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <vector>
+
+/*
+    Compact binary plugin state: a header, then one (parameter ID hash, value)
+    pair per parameter. Values are stored unnormalised so a range change in a
+    later version still recalls the same setting. Unknown hashes are skipped
+    and parameters missing from the data go back to their defaults, so the
+    format survives parameters being added or removed.
+
+    Layout, little endian:
+        uint32 magic 'MBCS', uint16 version, uint16 count,
+        count * { uint32 FNV-1a hash of the parameter ID, float32 value }
+*/
+namespace ParameterState
+{
+    constexpr juce::uint32 magic = 0x5343424d; // "MBCS" read as little endian bytes
+    constexpr int currentVersion = 1;
+
+    juce::uint32 hashParameterID(const juce::String& parameterID);
+
+    /** Normalised values in AudioProcessor::getParameters() order. */
+    struct Snapshot
+    {
+        juce::String name;
+        std::vector<float> values;
+    };
+
+    Snapshot capture(const juce::AudioProcessor& processor, const juce::String& name = {});
+
+    void write(const juce::AudioProcessor& processor, juce::MemoryBlock& destData);
+
+    enum ReadResult
+    {
+        NotParameterState,  // no magic, may be an older format
+        Restored,
+        Rejected            // ours, but truncated or written by a newer version; nothing was changed
+    };
+
+    /** Sets every parameter from binary state. */
+    ReadResult read(juce::AudioProcessor& processor, const void* data, int sizeInBytes);
+}
@@ -1,47 +1,86 @@
 #include "Parameters.h"
+#include "../DSP/LinearPhaseCrossover.h"
 
 namespace Parameters
 {
-    const std::map<Names, juce::String>& GetParams()
+    namespace
     {
-        static const std::map<Names, juce::String> paramsMap =
+        juce::StringArray getChoices(ChoiceList choices)
         {
-            { Low_Mid_Crossover_Freq,  "Low-Mid Crossover Frequency" },
-            { Mid_High_Crossover_Freq, "Mid-High Crossover Frequency" },
+            juce::StringArray names;
 
-            { Threshold_Low_Band,  "Threshold Low Band" },
-            { Threshold_Mid_Band,  "Threshold Mid Band" },
-            { Threshold_High_Band, "Threshold High Band" },
+            switch (choices)
+            {
+            case RatioChoices:
+                for (auto choice : RatioValues)
+                    names.add(juce::String(static_cast<double>(choice), 1));
+                break;
 
-            { Attack_Low_Band,  "Attack Low Band" },
-            { Attack_Mid_Band,  "Attack Mid Band" },
-            { Attack_High_Band, "Attack High Band" },
+            case CrossoverModeChoices:
+                names = { "Linkwitz-Riley", "Linear Phase" };
+                break;
 
-            { Release_Low_Band,  "Release Low Band" },
-            { Release_Mid_Band,  "Release Mid Band" },
-            { Release_High_Band, "Release High Band" },
+            case PartitionSizeChoices:
+                for (int i = 0; i < NUM_PARTITION_SIZES; ++i)
+                    names.add(juce::String(LinearPhaseCrossover::getPartitionSizeForIndex(i)));
+                break;
 
-            { Ratio_Low_Band,  "Ratio Low Band" },
-            { Ratio_Mid_Band,  "Ratio Mid Band" },
-            { Ratio_High_Band, "Ratio High Band" },
+            case StereoModeChoices:
+                names = { "Left/Right", "Mid/Side", "Mid", "Side" };
+                break;
 
-            { Bypassed_Low_Band,  "Bypassed Low Band" },
-            { Bypassed_Mid_Band,  "Bypassed Mid Band" },
-            { Bypassed_High_Band, "Bypassed High Band" },
+            case NoChoices:
+                break;
+            }
 
-            { Mute_Low_Band,  "Mute Low Band" },
-            { Mute_Mid_Band,  "Mute Mid Band" },
-            { Mute_High_Band, "Mute High Band" },
+            jassert(!names.isEmpty());
+            return names;
+        }
+    }
+
+    float convertTo0to1(const juce::AudioProcessor& processor, Names name, float value)
+    {
+        if (getDescriptor(name).choices == RatioChoices)
+        {
+            const auto found = std::find(RatioValues.begin(), RatioValues.end(), value);
+            jassert(found != RatioValues.end()); // not one of the ratios on offer
+            value = static_cast<float>(std::distance(RatioValues.begin(), juce::jmin(found, RatioValues.end() - 1)));
+        }
+
+        return get<juce::RangedAudioParameter>(processor, name)->convertTo0to1(value);
+    }
 
-            { Solo_Low_Band,  "Solo Low Band" },
-            { Solo_Mid_Band,  "Solo Mid Band" },
-            { Solo_High_Band, "Solo High Band" },
+    juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
+    {
+        juce::AudioProcessorValueTreeState::ParameterLayout layout;
+
+        for (const auto& descriptor : Table)
+        {
+            switch (descriptor.type)
+            {
+            case FloatParameter:
+            {
+                auto range = juce::NormalisableRange<float>{ descriptor.minimum, descriptor.maximum, descriptor.interval, 1.f };
+                if (descriptor.skewed)
+                    range.setSkewForCentre(descriptor.skewCentre);
 
-            { Input_Gain,  "Input Gain" },
-            { Output_Gain, "Output Gain" },
-        };
+                layout.add(std::make_unique<juce::AudioParameterFloat>(
+                    descriptor.id, descriptor.id, range, descriptor.defaultValue));
+                break;
+            }
 
-        return paramsMap;
+            case ChoiceParameter:
+                layout.add(std::make_unique<juce::AudioParameterChoice>(
+                    descriptor.id, descriptor.id, getChoices(descriptor.choices), static_cast<int>(descriptor.defaultValue)));
+                break;
+
+            case BoolParameter:
+                layout.add(std::make_unique<juce::AudioParameterBool>(
+                    descriptor.id, descriptor.id, descriptor.defaultValue > 0.5f));
+                break;
+            }
+        }
+
+        return layout;
     }
 }
-
@@ -1,14 +1,16 @@
 #pragma once
 
 #include <JuceHeader.h>
-#include <map>
+#include <array>
+#include "../DSP/Constants.h"
 
 namespace Parameters
 {
+    // declared in the order the parameters are added to the layout, so a name is also its parameter index
     enum Names
     {
-        Low_Mid_Crossover_Freq,
-        Mid_High_Crossover_Freq,
+        Input_Gain,
+        Output_Gain,
 
         Threshold_Low_Band,
         Threshold_Mid_Band,
@@ -38,10 +40,207 @@ namespace Parameters
         Solo_Mid_Band,
         Solo_High_Band,
 
-        Input_Gain,
-        Output_Gain,
+        Low_Mid_Crossover_Freq,
+        Mid_High_Crossover_Freq,
+
+        Crossover_Mode,
+        Linear_Phase_Partition_Size,
+
+        Link_Front_Channels,
+        Link_Surround_Channels,
+        Link_Other_Channels,
+
+        Stereo_Mode_Low_Band,
+        Stereo_Mode_Mid_Band,
+        Stereo_Mode_High_Band,
+
+        Makeup_Gain_Low_Band,
+        Makeup_Gain_Mid_Band,
+        Makeup_Gain_High_Band,
+
+        Auto_Makeup_Low_Band,
+        Auto_Makeup_Mid_Band,
+        Auto_Makeup_High_Band,
+
+        Mix_Low_Band,
+        Mix_Mid_Band,
+        Mix_High_Band,
+
+        Mix,
+
+        NumParameters
+    };
+
+    enum Type
+    {
+        FloatParameter,
+        ChoiceParameter,
+        BoolParameter
+    };
+
+    enum ChoiceList
+    {
+        NoChoices,
+        RatioChoices,
+        CrossoverModeChoices,
+        PartitionSizeChoices,
+        StereoModeChoices
     };
 
-    /** Returns a map from each enum to its display name */
-    const std::map<Names, juce::String>& GetParams();
+    // the compressor reads these directly instead of parsing the choice names
+    inline constexpr std::array<float, 10> RatioValues{ 1.f, 1.5f, 2.f, 3.f, 4.f, 7.f, 10.f, 15.f, 20.f, 50.f };
+
+    struct Descriptor
+    {
+        Names name;
+        const char* id;
+        Type type;
+
+        // float parameters only
+        float minimum;
+        float maximum;
+        float interval;
+        bool skewed;
+        float skewCentre;
+
+        // the index for choices, 0 or 1 for bools
+        float defaultValue;
+        ChoiceList choices;
+
+        // 0 low, 1 mid, 2 high, -1 for global parameters
+        int band;
+    };
+
+    constexpr Descriptor floatParam(Names name, const char* id, float minimum, float maximum, float interval,
+        float defaultValue, int band = -1)
+    {
+        return { name, id, FloatParameter, minimum, maximum, interval, false, 0.f, defaultValue, NoChoices, band };
+    }
+
+    constexpr Descriptor skewedFloatParam(Names name, const char* id, float minimum, float maximum, float interval,
+        float skewCentre, float defaultValue, int band = -1)
+    {
+        return { name, id, FloatParameter, minimum, maximum, interval, true, skewCentre, defaultValue, NoChoices, band };
+    }
+
+    constexpr Descriptor choiceParam(Names name, const char* id, ChoiceList choices, int defaultIndex, int band = -1)
+    {
+        return { name, id, ChoiceParameter, 0.f, 0.f, 0.f, false, 0.f, static_cast<float>(defaultIndex), choices, band };
+    }
+
+    constexpr Descriptor boolParam(Names name, const char* id, int band = -1)
+    {
+        return { name, id, BoolParameter, 0.f, 1.f, 1.f, false, 0.f, 0.f, NoChoices, band };
+    }
+
+    inline constexpr std::array<Descriptor, NumParameters> Table
+    { {
+        skewedFloatParam(Input_Gain,  "Input Gain",  -24.f, 18.f, 0.1f, 0.f, 0.f),
+        skewedFloatParam(Output_Gain, "Output Gain", -24.f, 18.f, 0.1f, 0.f, 0.f),
+
+        floatParam(Threshold_Low_Band,  "Threshold Low Band",  MIN_THRESHOLD, MAX_DECIBELS, 0.1f, 0.f, 0),
+        floatParam(Threshold_Mid_Band,  "Threshold Mid Band",  MIN_THRESHOLD, MAX_DECIBELS, 0.1f, 0.f, 1),
+        floatParam(Threshold_High_Band, "Threshold High Band", MIN_THRESHOLD, MAX_DECIBELS, 0.1f, 0.f, 2),
+
+        skewedFloatParam(Attack_Low_Band,  "Attack Low Band",  0.1f, 100.f, 0.1f, 10.f, 50.f, 0),
+        skewedFloatParam(Attack_Mid_Band,  "Attack Mid Band",  0.1f, 100.f, 0.1f, 10.f, 50.f, 1),
+        skewedFloatParam(Attack_High_Band, "Attack High Band", 0.1f, 100.f, 0.1f, 10.f, 50.f, 2),
+
+        skewedFloatParam(Release_Low_Band,  "Release Low Band",  5.f, 500.f, 0.1f, 55.f, 250.f, 0),
+        skewedFloatParam(Release_Mid_Band,  "Release Mid Band",  5.f, 500.f, 0.1f, 55.f, 250.f, 1),
+        skewedFloatParam(Release_High_Band, "Release High Band", 5.f, 500.f, 0.1f, 55.f, 250.f, 2),
+
+        choiceParam(Ratio_Low_Band,  "Ratio Low Band",  RatioChoices, 3, 0),
+        choiceParam(Ratio_Mid_Band,  "Ratio Mid Band",  RatioChoices, 3, 1),
+        choiceParam(Ratio_High_Band, "Ratio High Band", RatioChoices, 3, 2),
+
+        boolParam(Bypassed_Low_Band,  "Bypassed Low Band",  0),
+        boolParam(Bypassed_Mid_Band,  "Bypassed Mid Band",  1),
+        boolParam(Bypassed_High_Band, "Bypassed High Band", 2),
+
+        boolParam(Mute_Low_Band,  "Mute Low Band",  0),
+        boolParam(Mute_Mid_Band,  "Mute Mid Band",  1),
+        boolParam(Mute_High_Band, "Mute High Band", 2),
+
+        boolParam(Solo_Low_Band,  "Solo Low Band",  0),
+        boolParam(Solo_Mid_Band,  "Solo Mid Band",  1),
+        boolParam(Solo_High_Band, "Solo High Band", 2),
+
+        floatParam(Low_Mid_Crossover_Freq,  "Low-Mid Crossover Frequency",  MIN_FREQUENCY, 999.f, 1.f, 450.f),
+        floatParam(Mid_High_Crossover_Freq, "Mid-High Crossover Frequency", 1000.f, MAX_FREQUENCY, 1.f, 2000.f),
+
+        choiceParam(Crossover_Mode,              "Crossover Mode",              CrossoverModeChoices, CrossoverMode::LinkwitzRiley),
+        choiceParam(Linear_Phase_Partition_Size, "Linear Phase Partition Size", PartitionSizeChoices, 1),
+
+        boolParam(Link_Front_Channels,    "Link Front Channels"),
+        boolParam(Link_Surround_Channels, "Link Surround Channels"),
+        boolParam(Link_Other_Channels,    "Link Other Channels"),
+
+        choiceParam(Stereo_Mode_Low_Band,  "Stereo Mode Low Band",  StereoModeChoices, StereoMode::LeftRight, 0),
+        choiceParam(Stereo_Mode_Mid_Band,  "Stereo Mode Mid Band",  StereoModeChoices, StereoMode::LeftRight, 1),
+        choiceParam(Stereo_Mode_High_Band, "Stereo Mode High Band", StereoModeChoices, StereoMode::LeftRight, 2),
+
+        skewedFloatParam(Makeup_Gain_Low_Band,  "Makeup Gain Low Band",  -24.f, 18.f, 0.1f, 0.f, 0.f, 0),
+        skewedFloatParam(Makeup_Gain_Mid_Band,  "Makeup Gain Mid Band",  -24.f, 18.f, 0.1f, 0.f, 0.f, 1),
+        skewedFloatParam(Makeup_Gain_High_Band, "Makeup Gain High Band", -24.f, 18.f, 0.1f, 0.f, 0.f, 2),
+
+        boolParam(Auto_Makeup_Low_Band,  "Auto Makeup Low Band",  0),
+        boolParam(Auto_Makeup_Mid_Band,  "Auto Makeup Mid Band",  1),
+        boolParam(Auto_Makeup_High_Band, "Auto Makeup High Band", 2),
+
+        floatParam(Mix_Low_Band,  "Mix Low Band",  0.f, 100.f, 1.f, 100.f, 0),
+        floatParam(Mix_Mid_Band,  "Mix Mid Band",  0.f, 100.f, 1.f, 100.f, 1),
+        floatParam(Mix_High_Band, "Mix High Band", 0.f, 100.f, 1.f, 100.f, 2),
+
+        floatParam(Mix, "Mix", 0.f, 100.f, 1.f, 100.f),
+    } };
+
+    constexpr bool isTableInOrder()
+    {
+        for (size_t i = 0; i < Table.size(); ++i)
+            if (Table[i].name != static_cast<Names>(i))
+                return false;
+
+        return true;
+    }
+
+    static_assert(isTableInOrder(), "every parameter must sit at the index of its name");
+
+    constexpr const Descriptor& getDescriptor(Names name) { return Table[static_cast<size_t>(name)]; }
+
+    /** The same parameter on another band, e.g. forBand(Attack_Low_Band, 2) is Attack_High_Band. */
+    constexpr Names forBand(Names lowBandName, int band)
+    {
+        return static_cast<Names>(lowBandName + band);
+    }
+
+    static_assert(getDescriptor(forBand(Mix_Low_Band, 2)).band == 2, "band parameters come in low, mid, high runs");
+
+    template<typename ParamType>
+    constexpr Type typeOf()
+    {
+        if constexpr (std::is_same_v<ParamType, juce::AudioParameterChoice>)
+            return ChoiceParameter;
+        else if constexpr (std::is_same_v<ParamType, juce::AudioParameterBool>)
+            return BoolParameter;
+        else
+            return FloatParameter;
+    }
+
+    /** Typed access by index, no ID lookup. The processor's layout must come from createParameterLayout(). */
+    template<typename ParamType>
+    ParamType* get(const juce::AudioProcessor& processor, Names name)
+    {
+        jassert((std::is_same_v<ParamType, juce::RangedAudioParameter> || typeOf<ParamType>() == getDescriptor(name).type));
+
+        auto* param = processor.getParameters()[name];
+        jassert(dynamic_cast<ParamType*>(param) != nullptr);
+        return static_cast<ParamType*>(param);
+    }
+
+    /** Normalised value of a plain one. Ratios are given as the ratio itself (4.f for 4:1),
+        every other choice by its index. */
+    float convertTo0to1(const juce::AudioProcessor& processor, Names name, float value);
+
+    juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 }
@@ -0,0 +1,277 @@
+/*
+  ==============================================================================
+
+    PresetBank.cpp
+    Created: 19 Oct 2026 9:48:05pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "PresetBank.h"
+#include "Parameters.h"
+
+namespace
+{
+    // if the host is not calling processBlock nobody picks the preset up, so apply it here instead
+    constexpr juce::uint32 audioThreadTimeoutMs = 200;
+
+    // program changes this soon after a restore come from the host loading the session
+    constexpr juce::uint32 restoreGuardMs = 1000;
+
+    // how often the message thread looks for a recall to apply or announce
+    constexpr int pollHz = 30;
+}
+
+PresetBank::PresetBank(juce::AudioProcessor& p) : processor(p)
+{
+}
+
+PresetBank::~PresetBank()
+{
+    stopTimer();
+}
+
+int PresetBank::addPreset(const juce::String& name)
+{
+    presets.push_back(std::make_unique<ParameterState::Snapshot>(ParameterState::capture(processor, name)));
+    startPolling();
+    return getNumPresets() - 1;
+}
+
+void PresetBank::addFactoryPresets()
+{
+    const auto& parameters = processor.getParameters();
+
+    // every preset starts from the defaults and changes only what it lists
+    auto addFactoryPreset = [&](const juce::String& name, std::initializer_list<std::pair<Parameters::Names, float>> values)
+        {
+            auto snapshot = std::make_unique<ParameterState::Snapshot>();
+            snapshot->name = name;
+
+            for (auto* param : parameters)
+                snapshot->values.push_back(param->getDefaultValue());
+
+            for (const auto& [paramName, value] : values)
+                snapshot->values[static_cast<size_t>(paramName)] = Parameters::convertTo0to1(processor, paramName, value);
+
+            presets.push_back(std::move(snapshot));
+        };
+
+    // ratios are given as the ratio, other choice parameters by index
+    addFactoryPreset("Default", {});
+
+    addFactoryPreset("Glue", {
+        { Parameters::Names::Threshold_Low_Band, -18.f },
+        { Parameters::Names::Threshold_Mid_Band, -18.f },
+        { Parameters::Names::Threshold_High_Band, -18.f },
+        { Parameters::Names::Ratio_Low_Band, 2.f },
+        { Parameters::Names::Ratio_Mid_Band, 2.f },
+        { Parameters::Names::Ratio_High_Band, 2.f },
+        { Parameters::Names::Attack_Low_Band, 30.f },
+        { Parameters::Names::Attack_Mid_Band, 30.f },
+        { Parameters::Names::Attack_High_Band, 30.f },
+        { Parameters::Names::Release_Low_Band, 150.f },
+        { Parameters::Names::Release_Mid_Band, 150.f },
+        { Parameters::Names::Release_High_Band, 150.f },
+        { Parameters::Names::Auto_Makeup_Low_Band, 1.f },
+        { Parameters::Names::Auto_Makeup_Mid_Band, 1.f },
+        { Parameters::Names::Auto_Makeup_High_Band, 1.f } });
+
+    addFactoryPreset("Punchy Low End", {
+        { Parameters::Names::Threshold_Low_Band, -24.f },
+        { Parameters::Names::Ratio_Low_Band, 4.f },
+        { Parameters::Names::Attack_Low_Band, 40.f },
+        { Parameters::Names::Release_Low_Band, 120.f },
+        { Parameters::Names::Makeup_Gain_Low_Band, 3.f } });
+
+    addFactoryPreset("Tame Highs", {
+        { Parameters::Names::Threshold_High_Band, -30.f },
+        { Parameters::Names::Ratio_High_Band, 4.f },
+        { Parameters::Names::Attack_High_Band, 5.f },
+        { Parameters::Names::Release_High_Band, 80.f } });
+
+    addFactoryPreset("Parallel Crush", {
+        { Parameters::Names::Threshold_Low_Band, -40.f },
+        { Parameters::Names::Threshold_Mid_Band, -40.f },
+        { Parameters::Names::Threshold_High_Band, -40.f },
+        { Parameters::Names::Ratio_Low_Band, 10.f },
+        { Parameters::Names::Ratio_Mid_Band, 10.f },
+        { Parameters::Names::Ratio_High_Band, 10.f },
+        { Parameters::Names::Auto_Makeup_Low_Band, 1.f },
+        { Parameters::Names::Auto_Makeup_Mid_Band, 1.f },
+        { Parameters::Names::Auto_Makeup_High_Band, 1.f },
+        { Parameters::Names::Mix, 40.f } });
+
+    startPolling();
+}
+
+juce::String PresetBank::getPresetName(int index) const
+{
+    if (!juce::isPositiveAndBelow(index, getNumPresets()))
+        return {};
+
+    return presets[static_cast<size_t>(index)]->name;
+}
+
+void PresetBank::setPresetName(int index, const juce::String& name)
+{
+    if (juce::isPositiveAndBelow(index, getNumPresets()))
+        presets[static_cast<size_t>(index)]->name = name;
+}
+
+void PresetBank::recall(int index)
+{
+    if (!juce::isPositiveAndBelow(index, getNumPresets()))
+        return;
+
+    // hosts re-select a program while loading a session, that must not undo the restored state
+    if (restoreGuard.load() && juce::Time::getMillisecondCounter() - restoreTime.load() < restoreGuardMs)
+        return;
+
+    if (currentPreset.exchange(index) == index)
+        return;
+
+    // a newer recall simply replaces one the audio thread has not picked up yet
+    recallTime.store(juce::Time::getMillisecondCounter());
+    pendingPreset.store(presets[static_cast<size_t>(index)].get());
+}
+
+void PresetBank::stateRestored()
+{
+    stateGeneration.fetch_add(1);
+    pendingPreset.store(nullptr);
+    appliedPreset.store(nullptr);
+
+    restoreTime.store(juce::Time::getMillisecondCounter());
+    restoreGuard.store(true);
+}
+
+void PresetBank::prepare(double sampleRate)
+{
+    // 5ms down, 5ms back up
+    fadeLength = juce::jmax(1, juce::roundToInt(sampleRate * 0.005));
+
+    // a preset still fading out was never applied, hand it back unless a newer recall or a restore came since
+    if (fadeState == FadingOut && fadingTo != nullptr && fadingGeneration == stateGeneration.load())
+    {
+        const ParameterState::Snapshot* expected = nullptr;
+        pendingPreset.compare_exchange_strong(expected, fadingTo);
+    }
+
+    fadeState = Idle;
+    fadingTo = nullptr;
+    fadePosition = 0;
+}
+
+template<typename SampleType>
+void PresetBank::process(juce::AudioBuffer<SampleType>& buffer, MultibandEngine<SampleType>& engine)
+{
+    if (fadeState == Idle)
+    {
+        // read before taking the preset, so a restore in between always wins
+        fadingGeneration = stateGeneration.load();
+        fadingTo = pendingPreset.exchange(nullptr);
+
+        if (fadingTo == nullptr)
+        {
+            engine.process(buffer);
+            return;
+        }
+
+        fadeState = FadingOut;
+        fadePosition = 0;
+    }
+
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = buffer.getNumChannels();
+
+    // the block is rendered in sections split where the settings change, so every sample is
+    // rendered with the settings it is heard with
+    for (int position = 0; position < numSamples;)
+    {
+        const int count = fadeState == Idle
+            ? numSamples - position
+            : juce::jmin(numSamples - position, fadeLength - fadePosition);
+
+        juce::AudioBuffer<SampleType> section(buffer.getArrayOfWritePointers(), numChannels, position, count);
+        engine.process(section);
+
+        position += count;
+
+        if (fadeState == Idle)
+            continue;
+
+        const auto startGain = static_cast<SampleType>(fadePosition) / static_cast<SampleType>(fadeLength);
+        const auto endGain = static_cast<SampleType>(fadePosition + count) / static_cast<SampleType>(fadeLength);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            if (fadeState == FadingOut)
+                section.applyGainRamp(channel, 0, count, SampleType(1) - startGain, SampleType(1) - endGain);
+            else
+                section.applyGainRamp(channel, 0, count, startGain, endGain);
+        }
+
+        fadePosition += count;
+
+        if (fadePosition < fadeLength)
+            continue;
+
+        if (fadeState == FadingIn)
+        {
+            fadeState = Idle;
+            continue;
+        }
+
+        // a restore since the recall owns the parameters now, just come back up
+        if (fadingGeneration == stateGeneration.load())
+        {
+            applySnapshot(*fadingTo);
+            appliedPreset.store(fadingTo);
+        }
+
+        fadeState = FadingIn;
+        fadePosition = 0;
+    }
+}
+
+void PresetBank::applySnapshot(const ParameterState::Snapshot& snapshot)
+{
+    const auto& parameters = processor.getParameters();
+    jassert(static_cast<size_t>(parameters.size()) == snapshot.values.size());
+
+    // plain atomic stores, the listeners are notified from the timer
+    for (int i = 0; i < parameters.size(); ++i)
+        parameters[i]->setValue(snapshot.values[static_cast<size_t>(i)]);
+}
+
+void PresetBank::startPolling()
+{
+    // recall() may come from any thread, so the timer is already running before the first one can
+    if (!isTimerRunning())
+        startTimerHz(pollHz);
+}
+
+void PresetBank::timerCallback()
+{
+    const auto* pending = pendingPreset.load();
+    if (pending != nullptr && juce::Time::getMillisecondCounter() - recallTime.load() > audioThreadTimeoutMs)
+    {
+        // only succeeds if the audio thread still has not taken it
+        if (pendingPreset.compare_exchange_strong(pending, nullptr))
+            appliedPreset.store(pending);
+    }
+
+    const auto* applied = appliedPreset.exchange(nullptr);
+    if (applied != nullptr)
+    {
+        for (auto* param : processor.getParameters())
+            param->setValueNotifyingHost(applied->values[static_cast<size_t>(param->getParameterIndex())]);
+
+        processor.updateHostDisplay(juce::AudioProcessor::ChangeDetails().withProgramChanged(true));
+    }
+}
+
+template void PresetBank::process<float>(juce::AudioBuffer<float>&, MultibandEngine<float>&);
+template void PresetBank::process<double>(juce::AudioBuffer<double>&, MultibandEngine<double>&);
@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    PresetBank.h
+    Created: 19 Oct 2026 9:48:05pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "ParameterState.h"
+#include "../DSP/MultibandEngine.h"
+
+/*
+    In-memory presets, each a precomputed snapshot of normalised values.
+    Recalling one only hands the audio thread a pointer: it dips the output,
+    stores the snapshot into the parameters mid-block, renders the rest of
+    the block with the new settings and fades them in, so a switch never
+    clicks and never touches the value tree. A message thread timer, running
+    for as long as there are presets, polls for the result and tells the
+    listeners (apvts, editor, host) what changed; nothing is posted from the
+    recalling thread.
+
+    Hosts call the program functions from any thread and often re-select
+    the current program while loading a session, so recalling the current
+    preset does nothing and state restored by setStateInformation is never
+    overwritten by a recall that was already on its way.
+*/
+struct PresetBank : private juce::Timer
+{
+    explicit PresetBank(juce::AudioProcessor& processor);
+    ~PresetBank() override;
+
+    /** Message thread. Adds the snapshot of the current parameter values, returns its index. */
+    int addPreset(const juce::String& name);
+
+    /** Message thread. */
+    void addFactoryPresets();
+
+    int getNumPresets() const { return static_cast<int>(presets.size()); }
+    juce::String getPresetName(int index) const;
+    void setPresetName(int index, const juce::String& name);
+    int getCurrentPreset() const { return currentPreset.load(); }
+
+    /** Any thread, lock and message free. Queues the preset for the audio thread, a recall of the current preset is ignored. */
+    void recall(int index);
+
+    /** Call before setStateInformation applies its values: drops any recall still in flight
+        and ignores program changes for a moment while the host finishes loading. */
+    void stateRestored();
+
+    /** A recall that was still fading out is kept and applied once processing resumes. */
+    void prepare(double sampleRate);
+
+    /** Audio thread: renders the block through the engine, switching presets mid-block if one is due. */
+    template<typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& buffer, MultibandEngine<SampleType>& engine);
+
+private:
+    enum FadeState
+    {
+        Idle,
+        FadingOut,
+        FadingIn
+    };
+
+    juce::AudioProcessor& processor;
+    std::vector<std::unique_ptr<ParameterState::Snapshot>> presets;
+    std::atomic<int> currentPreset{ 0 };
+
+    std::atomic<const ParameterState::Snapshot*> pendingPreset{ nullptr };
+    std::atomic<const ParameterState::Snapshot*> appliedPreset{ nullptr };
+    std::atomic<juce::uint32> recallTime{ 0 };
+
+    // bumped by every restore, a fade that started under an older generation is not applied
+    std::atomic<juce::uint32> stateGeneration{ 0 };
+
+    // program changes are ignored for a moment after a restore
+    std::atomic<bool> restoreGuard{ false };
+    std::atomic<juce::uint32> restoreTime{ 0 };
+
+    // audio thread only
+    FadeState fadeState{ Idle };
+    const ParameterState::Snapshot* fadingTo{ nullptr };
+    juce::uint32 fadingGeneration{ 0 };
+    int fadeLength{ 441 };
+    int fadePosition{ 0 };
+
+    void applySnapshot(const ParameterState::Snapshot& snapshot);
+    void startPolling();
+    void timerCallback() override;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetBank)
+};
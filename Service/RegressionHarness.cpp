@@ -0,0 +1,428 @@
+/*
+  ==============================================================================
+
+    RegressionHarness.cpp
+    Created: 19 Oct 2026 8:15:36pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#include "RegressionHarness.h"
+
+#if MBCOMP_REGRESSION_HARNESS
+
+#include <cstring>
+#include <limits>
+#include <functional>
+#include "../PluginProcessor.h"
+#include "../DSP/RealtimeSafety.h"
+
+namespace RegressionHarness
+{
+    namespace
+    {
+        constexpr double signalSeconds = 3.0;
+
+        //==============================================================================
+        // test signals, seeded so every run renders the same input
+
+        using SignalGenerator = std::function<void(juce::AudioBuffer<float>&, double)>;
+
+        void generateSweep(juce::AudioBuffer<float>& buffer, double sampleRate)
+        {
+            // exponential sine sweep, the right channel quieter so M/S has something to work with
+            const double startHz = 20.0;
+            const double endHz = 20000.0;
+            const double duration = buffer.getNumSamples() / sampleRate;
+            const double k = std::log(endHz / startHz);
+
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+            {
+                const double t = i / sampleRate;
+                const double phase = juce::MathConstants<double>::twoPi * startHz * duration / k * (std::exp(t * k / duration) - 1.0);
+                const float sample = 0.5f * static_cast<float>(std::sin(phase));
+
+                buffer.setSample(0, i, sample);
+                buffer.setSample(1, i, 0.7f * sample);
+            }
+        }
+
+        void generateNoise(juce::AudioBuffer<float>& buffer, double)
+        {
+            juce::Random random(0x600d);
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+                for (int i = 0; i < buffer.getNumSamples(); ++i)
+                    buffer.setSample(ch, i, 0.25f * (random.nextFloat() * 2.0f - 1.0f));
+        }
+
+        void generateDrums(juce::AudioBuffer<float>& buffer, double sampleRate)
+        {
+            // 120 bpm: kick on every beat, snare on 2 and 4, hats on the eighths
+            juce::Random random(0xd2u);
+            const int samplesPerEighth = juce::roundToInt(sampleRate * 0.25);
+            float lastNoise = 0.0f;
+            double kickPhase = 0.0;
+
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+            {
+                const int eighth = i / samplesPerEighth;
+                const double t = (i % samplesPerEighth) / sampleRate;
+                const double beatT = (i % (2 * samplesPerEighth)) / sampleRate;
+
+                const float noise = random.nextFloat() * 2.0f - 1.0f;
+                const float hat = (noise - lastNoise) * 0.15f * static_cast<float>(std::exp(-t / 0.03));
+                lastNoise = noise;
+
+                kickPhase += juce::MathConstants<double>::twoPi * (50.0 + 70.0 * std::exp(-beatT / 0.04)) / sampleRate;
+                const float kick = 0.8f * static_cast<float>(std::sin(kickPhase) * std::exp(-beatT / 0.15));
+
+                float snare = 0.0f;
+                if (eighth % 4 == 2)
+                {
+                    const double decay = std::exp(-t / 0.08);
+                    snare = static_cast<float>((0.4 * noise + 0.3 * std::sin(juce::MathConstants<double>::twoPi * 180.0 * t)) * decay);
+                }
+
+                buffer.setSample(0, i, kick + snare + hat);
+                buffer.setSample(1, i, kick + 0.8f * snare - hat);
+            }
+        }
+
+        void generateSilenceToBurst(juce::AudioBuffer<float>& buffer, double sampleRate)
+        {
+            // one second of silence, a full scale burst, then silence again for the release
+            buffer.clear();
+
+            juce::Random random(0xb0057);
+            const int burstStart = juce::roundToInt(sampleRate);
+            const int burstEnd = juce::jmin(buffer.getNumSamples(), burstStart + juce::roundToInt(sampleRate * 0.3));
+
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+                for (int i = burstStart; i < burstEnd; ++i)
+                    buffer.setSample(ch, i, random.nextFloat() * 2.0f - 1.0f);
+        }
+
+        struct Signal
+        {
+            const char* name;
+            SignalGenerator generate;
+        };
+
+        const std::array<Signal, 4> signals
+        {{
+            { "sweep", generateSweep },
+            { "noise", generateNoise },
+            { "drums", generateDrums },
+            { "burst", generateSilenceToBurst }
+        }};
+
+        //==============================================================================
+        struct ParameterSet
+        {
+            const char* name;
+            std::vector<std::pair<Parameters::Names, float>> values;
+
+            // set halfway through the render, between two processBlock calls
+            std::vector<std::pair<Parameters::Names, float>> midRenderValues{};
+        };
+
+        const std::vector<ParameterSet>& getParameterSets()
+        {
+            using namespace Parameters;
+
+            static const std::vector<ParameterSet> sets
+            {
+                { "default", {} },
+                { "heavy", {
+                    { Threshold_Low_Band, -40.0f }, { Threshold_Mid_Band, -40.0f }, { Threshold_High_Band, -40.0f },
+                    { Ratio_Low_Band, 20.0f }, { Ratio_Mid_Band, 20.0f }, { Ratio_High_Band, 20.0f },
+                    { Attack_Low_Band, 1.0f }, { Attack_Mid_Band, 1.0f }, { Attack_High_Band, 1.0f },
+                    { Release_Low_Band, 50.0f }, { Release_Mid_Band, 50.0f }, { Release_High_Band, 50.0f } } },
+                { "linear_phase", {
+                    { Crossover_Mode, static_cast<float>(CrossoverMode::LinearPhase) },
+                    { Threshold_Low_Band, -24.0f }, { Threshold_Mid_Band, -24.0f }, { Threshold_High_Band, -24.0f } } },
+                { "crossover_switch", {
+                    { Threshold_Low_Band, -24.0f }, { Threshold_Mid_Band, -24.0f }, { Threshold_High_Band, -24.0f },
+                    { Mix, 50.0f } }, {
+                    { Crossover_Mode, static_cast<float>(CrossoverMode::LinearPhase) } } },
+                { "mid_side", {
+                    { Stereo_Mode_Mid_Band, static_cast<float>(StereoMode::MidSide) },
+                    { Stereo_Mode_High_Band, static_cast<float>(StereoMode::SideOnly) },
+                    { Threshold_Mid_Band, -30.0f }, { Threshold_High_Band, -30.0f } } },
+                { "parallel", {
+                    { Threshold_Low_Band, -30.0f }, { Threshold_Mid_Band, -30.0f }, { Threshold_High_Band, -30.0f },
+                    { Mix_Low_Band, 50.0f }, { Mix_Mid_Band, 50.0f }, { Mix_High_Band, 50.0f },
+                    { Makeup_Gain_Mid_Band, 6.0f }, { Mix, 75.0f } } }
+            };
+
+            return sets;
+        }
+
+        const std::array<double, 3> sampleRates{ 44100.0, 48000.0, 96000.0 };
+        const std::array<int, 4> blockSizes{ 32, 64, 512, 997 };
+
+        //==============================================================================
+        struct Render
+        {
+            juce::AudioBuffer<float> output;
+
+            // allocations and locks inside processBlock, counted when MBCOMP_REALTIME_CHECKS is on
+            int realtimeViolations{ 0 };
+        };
+
+        Render render(const juce::AudioBuffer<float>& input, const ParameterSet& set,
+            double sampleRate, int blockSize)
+        {
+            MBCompAudioProcessor processor;
+
+            auto applyValues = [&processor](const std::vector<std::pair<Parameters::Names, float>>& values)
+                {
+                    for (const auto& [name, value] : values)
+                        Parameters::get<juce::RangedAudioParameter>(processor, name)->setValueNotifyingHost(
+                            Parameters::convertTo0to1(processor, name, value));
+                };
+
+            applyValues(set.values);
+
+            processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+            processor.prepareToPlay(sampleRate, blockSize);
+
+            Render result{ input };
+            auto& output = result.output;
+            juce::MidiBuffer midi;
+
+            const int violationsBefore = RealtimeSafety::getNumViolationsOnThisThread();
+
+            // On a sub-block boundary, so every block size hears the change on the same sample;
+            // a host block that straddles it is split in two.
+            const int changeAt = set.midRenderValues.empty() ? output.getNumSamples()
+                : output.getNumSamples() / 2 / ENGINE_SUB_BLOCK_SIZE * ENGINE_SUB_BLOCK_SIZE;
+
+            for (int start = 0; start < output.getNumSamples();)
+            {
+                if (start == changeAt)
+                    applyValues(set.midRenderValues);
+
+                const int end = start < changeAt ? juce::jmin(start + blockSize, changeAt) : start + blockSize;
+                const int numSamples = juce::jmin(end, output.getNumSamples()) - start;
+                juce::AudioBuffer<float> block(output.getArrayOfWritePointers(), output.getNumChannels(), start, numSamples);
+                processor.processBlock(block, midi);
+                start += numSamples;
+            }
+
+            result.realtimeViolations = RealtimeSafety::getNumViolationsOnThisThread() - violationsBefore;
+
+            processor.releaseResources();
+            return result;
+        }
+
+        //==============================================================================
+        struct Difference
+        {
+            juce::int64 maxUlps{ 0 };
+            float maxErrorDb{ -std::numeric_limits<float>::infinity() };
+            int numFailingSamples{ 0 };
+            bool shapesMatch{ true };
+        };
+
+        // maps float bit patterns onto a line where adjacent floats differ by one
+        juce::int64 toOrderedInt(float value)
+        {
+            juce::int32 bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits < 0 ? static_cast<juce::int64>(std::numeric_limits<juce::int32>::min()) - bits : bits;
+        }
+
+        Difference compare(const juce::AudioBuffer<float>& a, const juce::AudioBuffer<float>& b, const Tolerance& tolerance)
+        {
+            Difference difference;
+
+            if (a.getNumChannels() != b.getNumChannels() || a.getNumSamples() != b.getNumSamples())
+            {
+                difference.shapesMatch = false;
+                return difference;
+            }
+
+            for (int ch = 0; ch < a.getNumChannels(); ++ch)
+            {
+                const float* pa = a.getReadPointer(ch);
+                const float* pb = b.getReadPointer(ch);
+
+                for (int i = 0; i < a.getNumSamples(); ++i)
+                {
+                    const auto ulps = std::abs(toOrderedInt(pa[i]) - toOrderedInt(pb[i]));
+                    const float errorDb = juce::Decibels::gainToDecibels(std::abs(pa[i] - pb[i]), -400.0f);
+
+                    difference.maxUlps = juce::jmax(difference.maxUlps, ulps);
+                    difference.maxErrorDb = juce::jmax(difference.maxErrorDb, errorDb);
+
+                    if (ulps > tolerance.maxUlps && errorDb > tolerance.maxErrorDb)
+                        ++difference.numFailingSamples;
+                }
+            }
+
+            return difference;
+        }
+
+        juce::String describe(const Difference& difference)
+        {
+            if (!difference.shapesMatch)
+                return "length or channel count differs";
+
+            return juce::String(difference.maxUlps) + " ulps max, "
+                + juce::String(difference.maxErrorDb, 1) + " dB max error, "
+                + juce::String(difference.numFailingSamples) + " samples out of tolerance";
+        }
+
+        bool passes(const Difference& difference)
+        {
+            return difference.shapesMatch && difference.numFailingSamples == 0;
+        }
+
+        //==============================================================================
+        // references are 32 bit float WAV, which round trips the rendered samples exactly
+
+        bool writeReference(const juce::File& file, const juce::AudioBuffer<float>& buffer, double sampleRate)
+        {
+            file.deleteFile();
+
+            std::unique_ptr<juce::FileOutputStream> stream(file.createOutputStream());
+            if (stream == nullptr)
+                return false;
+
+            juce::WavAudioFormat format;
+            std::unique_ptr<juce::AudioFormatWriter> writer(
+                format.createWriterFor(stream.get(), sampleRate, static_cast<unsigned int>(buffer.getNumChannels()), 32, {}, 0));
+
+            if (writer == nullptr)
+                return false;
+
+            stream.release(); // the writer owns it now
+            return writer->writeFromAudioSampleBuffer(buffer, 0, buffer.getNumSamples());
+        }
+
+        bool readReference(const juce::File& file, juce::AudioBuffer<float>& buffer)
+        {
+            juce::WavAudioFormat format;
+            std::unique_ptr<juce::AudioFormatReader> reader(format.createReaderFor(file.createInputStream().release(), true));
+
+            if (reader == nullptr)
+                return false;
+
+            buffer.setSize(static_cast<int>(reader->numChannels), static_cast<int>(reader->lengthInSamples));
+            return reader->read(&buffer, 0, buffer.getNumSamples(), 0, true, true);
+        }
+    }
+
+    //==============================================================================
+    juce::String run(const Options& options)
+    {
+        options.referenceDirectory.createDirectory();
+
+        juce::StringArray report;
+        int numFailed = 0, numRecorded = 0, numBlockSizeDependent = 0, numCases = 0;
+
+        auto checkRealtimeSafety = [&report, &numFailed](const Render& render, const juce::String& name)
+            {
+                if (render.realtimeViolations == 0)
+                    return;
+
+                ++numFailed;
+                report.add("FAIL     " + name + ": " + juce::String(render.realtimeViolations)
+                    + " allocations or locks inside processBlock");
+            };
+
+#if MBCOMP_REALTIME_CHECKS
+        // a checker that misses things would pass every render below
+        const auto missedBySelfCheck = RealtimeSafety::runSelfCheck();
+        for (const auto& missed : missedBySelfCheck)
+        {
+            ++numFailed;
+            report.add("FAIL     realtime checker: " + missed + " inside a realtime section was not reported");
+        }
+#endif
+
+        for (const double sampleRate : sampleRates)
+        {
+            juce::AudioBuffer<float> input(2, juce::roundToInt(sampleRate * signalSeconds));
+
+            for (const auto& signal : signals)
+            {
+                signal.generate(input, sampleRate);
+
+                for (const auto& set : getParameterSets())
+                {
+                    const auto caseName = juce::String(signal.name) + "_" + set.name + "_" + juce::String(juce::roundToInt(sampleRate));
+                    ++numCases;
+
+                    const auto referenceRender = render(input, set, sampleRate, options.referenceBlockSize);
+                    const auto& reference = referenceRender.output;
+                    checkRealtimeSafety(referenceRender, caseName + " @" + juce::String(options.referenceBlockSize));
+
+                    const auto referenceFile = options.referenceDirectory.getChildFile(caseName + ".wav");
+                    juce::AudioBuffer<float> golden;
+
+                    if (!referenceFile.existsAsFile())
+                    {
+                        ++numRecorded;
+                        report.add((writeReference(referenceFile, reference, sampleRate) ? "RECORDED " : "WRITE FAILED ") + caseName);
+                    }
+                    else if (!readReference(referenceFile, golden))
+                    {
+                        ++numFailed;
+                        report.add("FAIL     " + caseName + ": could not read " + referenceFile.getFileName());
+                    }
+                    else
+                    {
+                        const auto difference = compare(reference, golden, options.goldenTolerance);
+                        if (!passes(difference))
+                        {
+                            ++numFailed;
+                            report.add("FAIL     " + caseName + ": " + describe(difference));
+                        }
+                    }
+
+                    // block size dependence, against this run's reference block size render
+                    for (const int blockSize : blockSizes)
+                    {
+                        if (blockSize == options.referenceBlockSize)
+                            continue;
+
+                        const auto blockRender = render(input, set, sampleRate, blockSize);
+                        checkRealtimeSafety(blockRender, caseName + " @" + juce::String(blockSize));
+
+                        const auto difference = compare(blockRender.output, reference, options.blockSizeTolerance);
+                        if (!passes(difference))
+                        {
+                            ++numBlockSizeDependent;
+                            report.add("BLOCK    " + caseName + " @" + juce::String(blockSize) + " vs @"
+                                + juce::String(options.referenceBlockSize) + ": " + describe(difference));
+                        }
+                    }
+                }
+            }
+        }
+
+        juce::String summary;
+        summary << numCases << " cases, " << numFailed << " failed, " << numRecorded << " recorded, "
+            << numBlockSizeDependent << " block size dependent renders\n"
+            << "references: " << options.referenceDirectory.getFullPathName();
+
+#if ! MBCOMP_REALTIME_CHECKS
+        summary << "\nrealtime checks are compiled out, allocations inside processBlock were not counted";
+#endif
+
+        // call stacks for the first few realtime violations
+        const auto realtimeReports = RealtimeSafety::takeReports();
+        for (int i = 0; i < juce::jmin(3, realtimeReports.size()); ++i)
+            report.add(realtimeReports[i]);
+
+        if (report.isEmpty())
+            return summary;
+
+        return summary + "\n\n" + report.joinIntoString("\n");
+    }
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    RegressionHarness.h
+    Created: 19 Oct 2026 8:15:36pm
+    Author:  kyleb
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "../DSP/Constants.h"
+
+#if MBCOMP_REGRESSION_HARNESS
+
+/*
+    Golden output harness for the whole processor. Fixed, seeded test signals
+    are rendered through a fresh MBCompAudioProcessor for every parameter set,
+    sample rate and block size.
+
+    Renders at the reference block size are compared against the WAV files in
+    the reference directory; missing references are recorded instead. Every
+    other block size is compared against the reference block size render of
+    the same run, so any dependence on the host's buffer size shows up even
+    when nothing regressed. With MBCOMP_REALTIME_CHECKS on, any allocation or
+    lock inside processBlock fails the render it happened in, and the checker
+    first proves it catches an AudioBuffer resize.
+*/
+namespace RegressionHarness
+{
+    struct Tolerance
+    {
+        // either bound passing accepts the sample
+        int maxUlps{ 16 };
+        float maxErrorDb{ -120.0f };
+    };
+
+    struct Options
+    {
+        juce::File referenceDirectory;
+        Tolerance goldenTolerance;
+        Tolerance blockSizeTolerance{ 16, -90.0f };
+        int referenceBlockSize{ 512 };
+    };
+
+    /** Renders everything and returns a readable report. Call off the message thread. */
+    juce::String run(const Options& options);
+}
+
+#endif
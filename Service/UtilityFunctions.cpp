@@ -57,13 +57,9 @@ void addLabelPairs(juce::Array<RotarySliderWithLabels::LabelPos>& labels,
 // Internal helper to grab a RangedAudioParameter by ID
 juce::RangedAudioParameter& getRangedParam(
     juce::AudioProcessorValueTreeState& apvts,
-    const std::map<Parameters::Names, juce::String>& paramsMap,
     Parameters::Names paramID)
 {
-    auto* p = dynamic_cast<juce::RangedAudioParameter*>(
-        apvts.getParameter(paramsMap.at(paramID)));
-    jassert(p != nullptr);
-    return *p;
+    return *Parameters::get<juce::RangedAudioParameter>(apvts.processor, paramID);
 }
 
 //==============================================================================
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <JuceHeader.h>
-#include <map>
 #include <memory>
 #include "../PluginProcessor.h"
 #include "../GUI/RotarySliderWithLabels.h"
@@ -13,31 +12,28 @@
 inline void makeAttachment(
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>& attachment,
     juce::AudioProcessorValueTreeState& apvts,
-    const std::map<Parameters::Names, juce::String>& paramsMap,
     Parameters::Names paramID,
     juce::Slider& slider) noexcept
 {
     attachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
-        apvts, paramsMap.at(paramID), slider);
+        apvts, Parameters::getDescriptor(paramID).id, slider);
 }
 
 /// Creates a button attachment for the given parameter ID.
 inline void makeAttachment(
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment>& attachment,
     juce::AudioProcessorValueTreeState& apvts,
-    const std::map<Parameters::Names, juce::String>& paramsMap,
     Parameters::Names paramID,
     juce::Button& button) noexcept
 {
     attachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
-        apvts, paramsMap.at(paramID), button);
+        apvts, Parameters::getDescriptor(paramID).id, button);
 }
 
 //==============================================================================
 /// Retrieves a RangedAudioParameter by enum ID; asserts if not found.
 juce::RangedAudioParameter& getRangedParam(
     juce::AudioProcessorValueTreeState& apvts,
-    const std::map<Parameters::Names, juce::String>& paramsMap,
     Parameters::Names paramID);
 
 //==============================================================================